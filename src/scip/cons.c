@@ -5851,7 +5851,9 @@ SCIP_RETCODE SCIPconsCreate(
 
    /* create constraint data */
    SCIP_ALLOC( BMSallocBlockMemory(blkmem, cons) );
-   SCIP_ALLOC( BMSduplicateBlockMemoryArray(blkmem, &(*cons)->name, name, strlen(name)+1) );
+   (*cons)->namelen = (int) strlen(name);
+   SCIP_ALLOC( BMSduplicateBlockMemoryArray(blkmem, &(*cons)->name, name, (*cons)->namelen+1) );
+   (*cons)->namehash = SCIPhashKeyValString(NULL, (*cons)->name);
 #ifndef NDEBUG
    (*cons)->scip = set->scip;
 #endif
@@ -5891,6 +5893,7 @@ SCIP_RETCODE SCIPconsCreate(
    (*cons)->obsolete = FALSE;
    (*cons)->markpropagate = TRUE;
    (*cons)->deleted = FALSE;
+   (*cons)->inconsnames = FALSE;
    (*cons)->update = FALSE;
    (*cons)->updateinsert = FALSE;
    (*cons)->updateactivate = FALSE;
@@ -6121,10 +6124,12 @@ SCIP_RETCODE SCIPconsChgName(
    assert(cons->name != NULL);
 
    /* free old constraint name */
-   BMSfreeBlockMemoryArray(blkmem, &cons->name, strlen(cons->name)+1);
+   BMSfreeBlockMemoryArray(blkmem, &cons->name, cons->namelen+1);
 
    /* copy new constraint name */
-   SCIP_ALLOC( BMSduplicateBlockMemoryArray(blkmem, &cons->name, name, strlen(name)+1) );
+   cons->namelen = (int) strlen(name);
+   SCIP_ALLOC( BMSduplicateBlockMemoryArray(blkmem, &cons->name, name, cons->namelen+1) );
+   cons->namehash = SCIPhashKeyValString(NULL, cons->name);
 
    return SCIP_OKAY;
 }
@@ -6179,7 +6184,7 @@ SCIP_RETCODE SCIPconsFree(
    assert((*cons)->consspos == -1);
 
    /* free constraint */
-   BMSfreeBlockMemoryArray(blkmem, &(*cons)->name, strlen((*cons)->name)+1);
+   BMSfreeBlockMemoryArray(blkmem, &(*cons)->name, (*cons)->namelen+1);
    BMSfreeBlockMemory(blkmem, cons);
 
    return SCIP_OKAY;
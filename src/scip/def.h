@@ -431,6 +431,30 @@ extern "C" {
 
 #define SCIP_UNUSED(x) ((void) (x))
 
+/*
+ * Software prefetch hint; a no-op on compilers without support
+ */
+
+#if defined(__GNUC__)
+#define SCIP_PREFETCH_READ(addr)  __builtin_prefetch((const void*)(addr), 0, 1)
+#define SCIP_PREFETCH_WRITE(addr) __builtin_prefetch((const void*)(addr), 1, 1)
+#else
+#define SCIP_PREFETCH_READ(addr)  do { } while( FALSE )
+#define SCIP_PREFETCH_WRITE(addr) do { } while( FALSE )
+#endif
+
+/*
+ * Branch prediction hints for conditions with a strongly biased outcome; a plain condition on compilers without support
+ */
+
+#if defined(__GNUC__)
+#define SCIP_LIKELY(cond)   __builtin_expect((cond), 1)
+#define SCIP_UNLIKELY(cond) __builtin_expect((cond), 0)
+#else
+#define SCIP_LIKELY(cond)   (cond)
+#define SCIP_UNLIKELY(cond) (cond)
+#endif
+
 /*
  * Define to mark deprecated API functions
  */
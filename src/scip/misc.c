@@ -2613,15 +2613,18 @@ SCIP_Bool SCIPhashtableExists(
    return (SCIPhashtableRetrieve(hashtable, hashtable->hashgetkey(hashtable->userptr, element)) != NULL);
 }
 
-/** removes element from the hash table, if it exists */
-SCIP_RETCODE SCIPhashtableRemove(
+/** removes element with given key and hash value from the hash table, if it exists; if element is not NULL, the
+ *  entry is only removed if it stores exactly this element
+ */
+static
+SCIP_RETCODE hashtableRemove(
    SCIP_HASHTABLE*       hashtable,          /**< hash table */
-   void*                 element             /**< element to remove from the table */
+   void*                 key,                /**< key of element */
+   uint32_t              hashval,            /**< hash value of element */
+   void*                 element,            /**< element that must be stored under the key, or NULL to remove any element with this key */
+   SCIP_Bool*            removed             /**< pointer to store whether an element was removed, or NULL */
    )
 {
-   void* key;
-   uint64_t keyval;
-   uint32_t hashval;
    uint32_t elemdistance;
    uint32_t distance;
    uint32_t pos;
@@ -2633,12 +2636,10 @@ SCIP_RETCODE SCIPhashtableRemove(
    assert(hashtable->hashgetkey != NULL);
    assert(hashtable->hashkeyeq != NULL);
    assert(hashtable->hashkeyval != NULL);
-   assert(element != NULL);
+   assert(key != NULL);
 
-   /* get the hash key and its hash value */
-   key = hashtable->hashgetkey(hashtable->userptr, element);
-   keyval = hashtable->hashkeyval(hashtable->userptr, key);
-   hashval = hashvalue(keyval);
+   if( removed != NULL )
+      *removed = FALSE;
 
    elemdistance = 0;
    pos = hashval>>(hashtable->shift);
@@ -2665,6 +2666,13 @@ SCIP_RETCODE SCIPhashtableRemove(
       ++elemdistance;
    }
 
+   /* the key maps to a different element, so do not remove the entry */
+   if( element != NULL && hashtable->slots[pos] != element )
+      return SCIP_OKAY;
+
+   if( removed != NULL )
+      *removed = TRUE;
+
    /* remove element */
    hashtable->hashes[pos] = 0;
    --hashtable->nelements;
@@ -2691,6 +2699,76 @@ SCIP_RETCODE SCIPhashtableRemove(
    return SCIP_OKAY;
 }
 
+/** removes element from the hash table, if it exists */
+SCIP_RETCODE SCIPhashtableRemove(
+   SCIP_HASHTABLE*       hashtable,          /**< hash table */
+   void*                 element             /**< element to remove from the table */
+   )
+{
+   void* key;
+   uint64_t keyval;
+
+   assert(hashtable != NULL);
+   assert(hashtable->hashgetkey != NULL);
+   assert(hashtable->hashkeyval != NULL);
+   assert(element != NULL);
+
+   /* get the hash key and its hash value */
+   key = hashtable->hashgetkey(hashtable->userptr, element);
+   keyval = hashtable->hashkeyval(hashtable->userptr, key);
+
+   return hashtableRemove(hashtable, key, hashvalue(keyval), NULL, NULL);
+}
+
+/** inserts element in hash table using a precomputed key value, thereby skipping the hashkeyval callback
+ *
+ *  @note multiple inserts of same element override the previous entry
+ */
+SCIP_RETCODE SCIPhashtableInsertKeyval(
+   SCIP_HASHTABLE*       hashtable,          /**< hash table */
+   void*                 element,            /**< element to insert into the table */
+   uint64_t              keyval              /**< precomputed key value of the element's key */
+   )
+{
+   void* key;
+
+   assert(hashtable != NULL);
+   assert(hashtable->hashgetkey != NULL);
+   assert(element != NULL);
+
+   SCIP_CALL( hashtableCheckLoad(hashtable) );
+
+   key = hashtable->hashgetkey(hashtable->userptr, element);
+   assert(keyval == hashtable->hashkeyval(hashtable->userptr, key));
+
+   return hashtableInsert(hashtable, element, key, hashvalue(keyval), TRUE);
+}
+
+/** removes element from the hash table if its key currently maps to exactly this element
+ *
+ *  In contrast to a retrieve followed by a remove, this performs only a single probe walk. The table may store a
+ *  different element under an equal key; in this case the entry is left untouched and *removed is set to FALSE.
+ */
+SCIP_RETCODE SCIPhashtableRemoveIfExists(
+   SCIP_HASHTABLE*       hashtable,          /**< hash table */
+   void*                 element,            /**< element to remove from the table */
+   uint64_t              keyval,             /**< precomputed key value of the element's key */
+   SCIP_Bool*            removed             /**< pointer to store whether the element was removed */
+   )
+{
+   void* key;
+
+   assert(hashtable != NULL);
+   assert(hashtable->hashgetkey != NULL);
+   assert(element != NULL);
+   assert(removed != NULL);
+
+   key = hashtable->hashgetkey(hashtable->userptr, element);
+   assert(keyval == hashtable->hashkeyval(hashtable->userptr, key));
+
+   return hashtableRemove(hashtable, key, hashvalue(keyval), element, removed);
+}
+
 /** removes all elements of the hash table */
 void SCIPhashtableRemoveAll(
    SCIP_HASHTABLE*       hashtable           /**< hash table */
@@ -2791,15 +2869,36 @@ SCIP_DECL_HASHKEYEQ(SCIPhashKeyEqString)
 SCIP_DECL_HASHKEYVAL(SCIPhashKeyValString)
 {  /*lint --e{715}*/
    const char* str;
+   size_t len;
    uint64_t hash;
 
    str = (const char*)key;
-   hash = 37;
-   while( *str != '\0' )
+   len = strlen(str);
+
+   /* seed with the length, so that strings sharing a common prefix already start from different states */
+   hash = 37 + (uint64_t)len;
+
+   /* consume one machine word per iteration instead of single characters; the memcpy() compiles into a plain
+    * unaligned load, and the multiplication by the golden ratio constant spreads the bits over the whole word
+    */
+   while( len >= sizeof(uint64_t) )
+   {
+      uint64_t block;
+
+      memcpy(&block, str, sizeof(uint64_t));
+      hash = (hash + block) * 0x9E3779B97F4A7C15ULL;
+      hash ^= hash >> 32;
+      str += sizeof(uint64_t);
+      len -= sizeof(uint64_t);
+   }
+
+   /* consume the remaining characters as before */
+   while( len > 0 )
    {
       hash *= 11;
       hash += (unsigned int)(*str); /*lint !e571*/
       str++;
+      len--;
    }
 
    return hash;
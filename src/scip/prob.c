@@ -37,6 +37,7 @@
 #include "scip/set.h"
 #include "scip/stat.h"
 #include "scip/struct_cons.h"
+#include "scip/struct_event.h"
 #include "scip/struct_lp.h"
 #include "scip/struct_prob.h"
 #include "scip/struct_set.h"
@@ -50,13 +51,50 @@
 #define OBJSCALE_MAXSCALE         1000000.0  /**< maximal scalar to reach objective integrality */
 #define OBJSCALE_MAXFINALSCALE       1000.0  /**< maximal final value to apply as scaling */
 
+#define PROB_PREFETCHDIST                 8  /**< number of loop iterations to prefetch ahead in variable walks */
+
+#define PROB_PAGEDOUBLESIZE            4096  /**< array byte size from which on reallocations grow at least by factor two */
+
+#define PROB_SMALLNAMETABLE              32  /**< maximal number of problem entries for which name lookups scan linearly
+                                              *   instead of probing the hash table */
+
 
 
 /*
  * dymanic memory arrays
  */
 
-/** resizes vars array to be able to store at least num entries */
+/** grows vars array to be able to store at least num entries; called only when the current size does not suffice */
+static
+SCIP_RETCODE probGrowVarsMem(
+   SCIP_PROB*            prob,               /**< problem data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int                   num                 /**< minimal number of slots in array */
+   )
+{
+   int newsize;
+
+   assert(num > prob->varssize);
+
+   newsize = SCIPsetCalcMemGrowSize(set, num);
+
+   /* the mem_arraygrowfac setting may be well below two; once the array spans multiple pages, grow at least by
+    * factor two so that the amortized cost of the reallocation copies stays linear
+    */
+   if( (size_t)newsize * sizeof(SCIP_VAR*) >= PROB_PAGEDOUBLESIZE && newsize < 2*prob->varssize )
+      newsize = 2*prob->varssize;
+
+   SCIP_ALLOC( BMSreallocMemoryArray(&prob->vars, newsize) );
+   SCIP_ALLOC( BMSreallocMemoryArray(&prob->vartypes, newsize) );
+   SCIP_ALLOC( BMSreallocMemoryArray(&prob->varobjs, newsize) );
+   prob->varssize = newsize;
+
+   return SCIP_OKAY;
+}
+
+/** resizes vars array to be able to store at least num entries; keeps the hot no-resize check apart from the cold
+ *  reallocation code, so that the check can be inlined at the call sites
+ */
 static
 SCIP_RETCODE probEnsureVarsMem(
    SCIP_PROB*            prob,               /**< problem data */
@@ -67,19 +105,39 @@ SCIP_RETCODE probEnsureVarsMem(
    assert(prob != NULL);
    assert(set != NULL);
 
-   if( num > prob->varssize )
+   if( SCIP_UNLIKELY(num > prob->varssize) )
    {
-      int newsize;
-
-      newsize = SCIPsetCalcMemGrowSize(set, num);
-      SCIP_ALLOC( BMSreallocMemoryArray(&prob->vars, newsize) );
-      prob->varssize = newsize;
+      SCIP_CALL( probGrowVarsMem(prob, set, num) );
    }
    assert(num <= prob->varssize);
 
    return SCIP_OKAY;
 }
 
+/** grows fixedvars array to be able to store at least num entries; called only when the current size does not suffice */
+static
+SCIP_RETCODE probGrowFixedvarsMem(
+   SCIP_PROB*            prob,               /**< problem data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int                   num                 /**< minimal number of slots in array */
+   )
+{
+   int newsize;
+
+   assert(num > prob->fixedvarssize);
+
+   newsize = SCIPsetCalcMemGrowSize(set, num);
+
+   /* grow large arrays at least by factor two (cf. probGrowVarsMem()) */
+   if( (size_t)newsize * sizeof(SCIP_VAR*) >= PROB_PAGEDOUBLESIZE && newsize < 2*prob->fixedvarssize )
+      newsize = 2*prob->fixedvarssize;
+
+   SCIP_ALLOC( BMSreallocMemoryArray(&prob->fixedvars, newsize) );
+   prob->fixedvarssize = newsize;
+
+   return SCIP_OKAY;
+}
+
 /** resizes fixedvars array to be able to store at least num entries */
 static
 SCIP_RETCODE probEnsureFixedvarsMem(
@@ -91,19 +149,39 @@ SCIP_RETCODE probEnsureFixedvarsMem(
    assert(prob != NULL);
    assert(set != NULL);
 
-   if( num > prob->fixedvarssize )
+   if( SCIP_UNLIKELY(num > prob->fixedvarssize) )
    {
-      int newsize;
-
-      newsize = SCIPsetCalcMemGrowSize(set, num);
-      SCIP_ALLOC( BMSreallocMemoryArray(&prob->fixedvars, newsize) );
-      prob->fixedvarssize = newsize;
+      SCIP_CALL( probGrowFixedvarsMem(prob, set, num) );
    }
    assert(num <= prob->fixedvarssize);
 
    return SCIP_OKAY;
 }
 
+/** grows deletedvars array to be able to store at least num entries; called only when the current size does not suffice */
+static
+SCIP_RETCODE probGrowDeletedvarsMem(
+   SCIP_PROB*            prob,               /**< problem data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int                   num                 /**< minimal number of slots in array */
+   )
+{
+   int newsize;
+
+   assert(num > prob->deletedvarssize);
+
+   newsize = SCIPsetCalcMemGrowSize(set, num);
+
+   /* grow large arrays at least by factor two (cf. probGrowVarsMem()) */
+   if( (size_t)newsize * sizeof(SCIP_VAR*) >= PROB_PAGEDOUBLESIZE && newsize < 2*prob->deletedvarssize )
+      newsize = 2*prob->deletedvarssize;
+
+   SCIP_ALLOC( BMSreallocMemoryArray(&prob->deletedvars, newsize) );
+   prob->deletedvarssize = newsize;
+
+   return SCIP_OKAY;
+}
+
 /** resizes deletedvars array to be able to store at least num entries */
 static
 SCIP_RETCODE probEnsureDeletedvarsMem(
@@ -115,19 +193,39 @@ SCIP_RETCODE probEnsureDeletedvarsMem(
    assert(prob != NULL);
    assert(set != NULL);
 
-   if( num > prob->deletedvarssize )
+   if( SCIP_UNLIKELY(num > prob->deletedvarssize) )
    {
-      int newsize;
-
-      newsize = SCIPsetCalcMemGrowSize(set, num);
-      SCIP_ALLOC( BMSreallocMemoryArray(&prob->deletedvars, newsize) );
-      prob->deletedvarssize = newsize;
+      SCIP_CALL( probGrowDeletedvarsMem(prob, set, num) );
    }
    assert(num <= prob->deletedvarssize);
 
    return SCIP_OKAY;
 }
 
+/** grows conss array to be able to store at least num entries; called only when the current size does not suffice */
+static
+SCIP_RETCODE probGrowConssMem(
+   SCIP_PROB*            prob,               /**< problem data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int                   num                 /**< minimal number of slots in array */
+   )
+{
+   int newsize;
+
+   assert(num > prob->consssize);
+
+   newsize = SCIPsetCalcMemGrowSize(set, num);
+
+   /* grow large arrays at least by factor two (cf. probGrowVarsMem()) */
+   if( (size_t)newsize * sizeof(SCIP_CONS*) >= PROB_PAGEDOUBLESIZE && newsize < 2*prob->consssize )
+      newsize = 2*prob->consssize;
+
+   SCIP_ALLOC( BMSreallocMemoryArray(&prob->conss, newsize) );
+   prob->consssize = newsize;
+
+   return SCIP_OKAY;
+}
+
 /** resizes conss array to be able to store at least num entries */
 static
 SCIP_RETCODE probEnsureConssMem(
@@ -139,13 +237,9 @@ SCIP_RETCODE probEnsureConssMem(
    assert(prob != NULL);
    assert(set != NULL);
 
-   if( num > prob->consssize )
+   if( SCIP_UNLIKELY(num > prob->consssize) )
    {
-      int newsize;
-
-      newsize = SCIPsetCalcMemGrowSize(set, num);
-      SCIP_ALLOC( BMSreallocMemoryArray(&prob->conss, newsize) );
-      prob->consssize = newsize;
+      SCIP_CALL( probGrowConssMem(prob, set, num) );
    }
    assert(num <= prob->consssize);
 
@@ -270,7 +364,8 @@ SCIP_RETCODE SCIPprobCreate(
    assert(prob != NULL);
 
    SCIP_ALLOC( BMSallocMemory(prob) );
-   SCIP_ALLOC( BMSduplicateMemoryArray(&(*prob)->name, name, strlen(name)+1) );
+   (*prob)->namelen = (int) strlen(name);
+   SCIP_ALLOC( BMSduplicateMemoryArray(&(*prob)->name, name, (*prob)->namelen+1) );
 
    (*prob)->probdata = probdata;
    (*prob)->probcopy = probcopy;
@@ -288,12 +383,15 @@ SCIP_RETCODE SCIPprobCreate(
    else
       (*prob)->varnames = NULL;
    (*prob)->vars = NULL;
+   (*prob)->vartypes = NULL;
+   (*prob)->varobjs = NULL;
    (*prob)->varssize = 0;
    (*prob)->nvars = 0;
    (*prob)->nbinvars = 0;
    (*prob)->nintvars = 0;
    (*prob)->nimplvars = 0;
    (*prob)->ncontvars = 0;
+   BMSclearMemoryArray((*prob)->bucketstart, 5);
    (*prob)->ncolvars = 0;
    (*prob)->fixedvars = NULL;
    (*prob)->fixedvarssize = 0;
@@ -302,6 +400,7 @@ SCIP_RETCODE SCIPprobCreate(
    (*prob)->deletedvarssize = 0;
    (*prob)->ndeletedvars = 0;
    (*prob)->nobjvars = 0;
+   (*prob)->nfracobjvars = 0;
    if( set->misc_useconstable )
    {
       SCIP_CALL( SCIPhashtableCreate(&(*prob)->consnames, blkmem,
@@ -317,6 +416,7 @@ SCIP_RETCODE SCIPprobCreate(
    (*prob)->startnvars = 0;
    (*prob)->startnconss = 0;
    (*prob)->objsense = SCIP_OBJSENSE_MINIMIZE;
+   (*prob)->objsensereal = 1.0;
    (*prob)->objoffset = 0.0;
    (*prob)->objscale = 1.0;
    (*prob)->objlim = SCIP_INVALID;
@@ -396,6 +496,66 @@ void SCIPprobSetCopy(
    prob->probcopy= probcopy;
 }
 
+/** removes and releases all remaining constraints during problem teardown
+ *
+ *  In contrast to repeated SCIPprobDelCons() calls, this neither maintains the constraint array invariants nor
+ *  removes the names from the consnames namespace, because both are freed together with the problem anyway.
+ */
+static
+SCIP_RETCODE probFreeAllConss(
+   SCIP_PROB*            prob,               /**< problem data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat                /**< dynamic problem statistics */
+   )
+{
+   int c;
+
+   assert(prob != NULL);
+   assert(blkmem != NULL);
+   assert(prob->nconss == 0 || prob->conss != NULL);
+
+   for( c = prob->nconss - 1; c >= 0; --c )
+   {
+      SCIP_CONS* cons;
+
+      cons = prob->conss[c];
+      assert(cons != NULL);
+      assert(cons->addconssetchg == NULL);
+      assert(cons->addarraypos == c);
+
+      /* if the problem is the transformed problem, deactivate and unlock constraint */
+      if( prob->transformed )
+      {
+         /* if constraint is a check-constraint, unlock roundings of constraint's variables */
+         if( SCIPconsIsChecked(cons) )
+         {
+            SCIP_CALL( SCIPconsAddLocks(cons, set, SCIP_LOCKTYPE_MODEL, -1, 0) );
+         }
+
+         /* deactivate constraint, if it is currently active */
+         if( cons->active && !cons->updatedeactivate )
+         {
+            SCIP_CALL( SCIPconsDeactivate(cons, set, stat) );
+         }
+      }
+      assert(!cons->active || cons->updatedeactivate);
+      assert(!cons->enabled || cons->updatedeactivate);
+
+      /* mark the constraint to be no longer in the problem; the name table is freed as a whole, so the membership flag
+       * must be reset here in case the constraint survives through captures and is added to another problem later
+       */
+      cons->addarraypos = -1;
+      cons->inconsnames = FALSE;
+
+      /* release constraint */
+      SCIP_CALL( SCIPconsRelease(&prob->conss[c], blkmem, set) );
+   }
+   prob->nconss = 0;
+
+   return SCIP_OKAY;
+}
+
 /** frees problem data structure */
 SCIP_RETCODE SCIPprobFree(
    SCIP_PROB**           prob,               /**< pointer to problem data structure */
@@ -417,19 +577,25 @@ SCIP_RETCODE SCIPprobFree(
    assert(set != NULL);
 
    /* remove all constraints from the problem */
-   while( (*prob)->nconss > 0 )
-   {
-      /*@todo for debug mode it even might sense, to sort them downwards after their arraypos */
-      assert((*prob)->conss != NULL);
-      SCIP_CALL( SCIPprobDelCons(*prob, blkmem, set, stat, (*prob)->conss[(*prob)->nconss - 1]) );
-   }
+   SCIP_CALL( probFreeAllConss(*prob, blkmem, set, stat) );
 
    if( (*prob)->transformed )
    {
+      uint64_t mask;
       int h;
 
-      /* unlock variables for all constraint handlers that don't need constraints */
-      for( h = 0; h < set->nconshdlrs; ++h )
+      /* unlock variables for all constraint handlers that don't need constraints; the cached bitmask allows to skip
+       * the handlers that need constraints without querying each one
+       */
+      mask = set->conshdlrneedsconsmask;
+      for( h = 0; h < MIN(set->nconshdlrs, 64); ++h, mask >>= 1 )
+      {
+         if( (mask & 1) == 0 )
+         {
+            SCIP_CALL( SCIPconshdlrUnlockVars(set->conshdlrs[h], set) );
+         }
+      }
+      for( h = 64; h < set->nconshdlrs; ++h )
       {
          if( !SCIPconshdlrNeedsCons(set->conshdlrs[h]) )
          {
@@ -457,11 +623,16 @@ SCIP_RETCODE SCIPprobFree(
       }
    }
 
-   /* release problem variables */
+   /* release problem variables; the variables are scattered in block memory, so prefetch the next ones to overlap
+    * their cache misses with the release work on the current variable
+    */
    for( v = (*prob)->nvars - 1; v >= 0; --v )
    {
       assert(SCIPvarGetProbindex((*prob)->vars[v]) >= 0);
 
+      if( v >= PROB_PREFETCHDIST )
+         SCIP_PREFETCH_WRITE((*prob)->vars[v - PROB_PREFETCHDIST]);
+
       if( SCIPvarGetNUses((*prob)->vars[v]) > 1 )
       {
          SCIPmessageFPrintWarning(messagehdlr, "%s variable <%s> not released when freeing SCIP problem <%s>.\n",
@@ -474,13 +645,15 @@ SCIP_RETCODE SCIPprobFree(
       SCIP_CALL( SCIPvarRemove((*prob)->vars[v], blkmem, NULL, set, TRUE) );
       SCIP_CALL( SCIPvarRelease(&(*prob)->vars[v], blkmem, set, eventqueue, lp) );
    }
-   BMSfreeMemoryArrayNull(&(*prob)->vars);
 
    /* release fixed problem variables */
    for( v = (*prob)->nfixedvars - 1; v >= 0; --v )
    {
       assert(SCIPvarGetProbindex((*prob)->fixedvars[v]) == -1);
 
+      if( v >= PROB_PREFETCHDIST )
+         SCIP_PREFETCH_WRITE((*prob)->fixedvars[v - PROB_PREFETCHDIST]);
+
       if( SCIPvarGetNUses((*prob)->fixedvars[v]) > 1 )
       {
          SCIPmessageFPrintWarning(messagehdlr, "%s variable <%s> not released when freeing SCIP problem <%s>.\n",
@@ -492,6 +665,9 @@ SCIP_RETCODE SCIPprobFree(
 
       SCIP_CALL( SCIPvarRelease(&(*prob)->fixedvars[v], blkmem, set, eventqueue, lp) );
    }
+   BMSfreeMemoryArrayNull(&(*prob)->vars);
+   BMSfreeMemoryArrayNull(&(*prob)->vartypes);
+   BMSfreeMemoryArrayNull(&(*prob)->varobjs);
    BMSfreeMemoryArrayNull(&(*prob)->fixedvars);
 
    assert(! unreleasedvar);
@@ -531,9 +707,11 @@ SCIP_RETCODE SCIPprobTransform(
    SCIP_PROB**           target              /**< pointer to target problem data structure */
    )
 {
-   SCIP_VAR* targetvar;
+   SCIP_VAR** targetvars;
    SCIP_CONS* targetcons;
    char transname[SCIP_MAXSTRLEN];
+   uint64_t mask;
+   int namelen;
    int v;
    int c;
    int h;
@@ -546,11 +724,34 @@ SCIP_RETCODE SCIPprobTransform(
    SCIPsetDebugMsg(set, "transform problem: original has %d variables\n", source->nvars);
 
    /* create target problem data (probdelorig and probtrans are not needed, probdata is set later) */
-   (void) SCIPsnprintf(transname, SCIP_MAXSTRLEN, "t_%s", source->name);
-   SCIP_CALL( SCIPprobCreate(target, blkmem, set, transname, source->probdelorig, source->probtrans, source->probdeltrans, 
+   /* compose the transformed problem name from the cached name length instead of parsing a format string */
+   namelen = MIN(source->namelen, SCIP_MAXSTRLEN-3);
+   memcpy(transname, "t_", 2);
+   memcpy(transname+2, source->name, namelen); /*lint !e776*/
+   transname[2+namelen] = '\0';
+   SCIP_CALL( SCIPprobCreate(target, blkmem, set, transname, source->probdelorig, source->probtrans, source->probdeltrans,
          source->probinitsol, source->probexitsol, source->probcopy, NULL, TRUE) );
    SCIPprobSetObjsense(*target, source->objsense);
 
+   /* the transformed problem receives one variable and constraint per original one; re-create the name hash tables
+    * with that capacity upfront, so that the inserts during the transformation never trigger a rehash
+    */
+   if( !set->misc_usesmalltables )
+   {
+      if( (*target)->varnames != NULL && source->nvars > SCIP_HASHSIZE_NAMES )
+      {
+         SCIPhashtableFree(&(*target)->varnames);
+         SCIP_CALL( SCIPhashtableCreate(&(*target)->varnames, blkmem, source->nvars,
+               SCIPhashGetKeyVar, SCIPhashKeyEqString, SCIPhashKeyValString, NULL) );
+      }
+      if( (*target)->consnames != NULL && source->nconss > SCIP_HASHSIZE_NAMES )
+      {
+         SCIPhashtableFree(&(*target)->consnames);
+         SCIP_CALL( SCIPhashtableCreate(&(*target)->consnames, blkmem, source->nconss,
+               SCIPhashGetKeyCons, SCIPhashKeyEqString, SCIPhashKeyValString, NULL) );
+      }
+   }
+
    /* transform objective limit */
    if( source->objlim < SCIP_INVALID )
       SCIPprobSetObjlim(*target, source->objlim);
@@ -559,14 +760,24 @@ SCIP_RETCODE SCIPprobTransform(
    if( source->dualbound < SCIP_INVALID )
       SCIPprobSetDualbound(*target, source->dualbound);
 
-   /* transform and copy all variables to target problem */
+   /* transform and copy all variables to target problem; this is done in two passes, so that the first pass streams
+    * through the source variables with prefetching, while the second pass only works on the freshly created (and
+    * therefore cache-resident) transformed variables
+    */
    SCIP_CALL( probEnsureVarsMem(*target, set, source->nvars) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &targetvars, source->nvars) );
+   for( v = 0; v < source->nvars; ++v )
+   {
+      if( v + PROB_PREFETCHDIST < source->nvars )
+         SCIP_PREFETCH_READ(source->vars[v + PROB_PREFETCHDIST]);
+      SCIP_CALL( SCIPvarTransform(source->vars[v], blkmem, set, stat, source->objsense, &targetvars[v]) );
+   }
    for( v = 0; v < source->nvars; ++v )
    {
-      SCIP_CALL( SCIPvarTransform(source->vars[v], blkmem, set, stat, source->objsense, &targetvar) );
-      SCIP_CALL( SCIPprobAddVar(*target, blkmem, set, lp, branchcand, eventfilter, eventqueue, targetvar) );
-      SCIP_CALL( SCIPvarRelease(&targetvar, blkmem, set, eventqueue, NULL) );
+      SCIP_CALL( SCIPprobAddVar(*target, blkmem, set, lp, branchcand, eventfilter, eventqueue, targetvars[v]) );
+      SCIP_CALL( SCIPvarRelease(&targetvars[v], blkmem, set, eventqueue, NULL) );
    }
+   SCIPsetFreeBufferArray(set, &targetvars);
    assert((*target)->nvars == source->nvars);
    assert((*target)->nobjvars == SCIPprobGetNObjVars(*target, set));
 
@@ -586,8 +797,18 @@ SCIP_RETCODE SCIPprobTransform(
       SCIP_CALL( SCIPconsRelease(&targetcons, blkmem, set) );
    }
 
-   /* lock variables for all constraint handlers that don't need constraints */
-   for( h = 0; h < set->nconshdlrs; ++h )
+   /* lock variables for all constraint handlers that don't need constraints; the cached bitmask allows to skip the
+    * handlers that need constraints without querying each one
+    */
+   mask = set->conshdlrneedsconsmask;
+   for( h = 0; h < MIN(set->nconshdlrs, 64); ++h, mask >>= 1 )
+   {
+      if( (mask & 1) == 0 )
+      {
+         SCIP_CALL( SCIPconshdlrLockVars(set->conshdlrs[h], set) );
+      }
+   }
+   for( h = 64; h < set->nconshdlrs; ++h )
    {
       if( !SCIPconshdlrNeedsCons(set->conshdlrs[h]) )
       {
@@ -685,10 +906,14 @@ void SCIPprobResortVars(
    if( ncontvars > 0 )
       SCIPsortPtr((void**)&vars[nbinvars + nintvars + nimplvars], SCIPvarComp, ncontvars);
 
-   /* after sorting, the problem index of each variable has to be adjusted */
+   /* after sorting, the problem index of each variable has to be adjusted and the parallel type and objective arrays
+    * must be rebuilt to stay aligned with the new variable positions
+    */
    for( v = 0; v < nvars; ++v )
    {
       vars[v]->probindex = v;
+      prob->vartypes[v] = (uint8_t) SCIPvarGetType(vars[v]);
+      prob->varobjs[v] = SCIPvarGetObj(vars[v]);
       SCIPdebugMessage("Variable: Problem index <%d>, original index <%d> \n", vars[v]->probindex, vars[v]->index);
    }
 }
@@ -717,83 +942,88 @@ void probInsertVar(
    SCIP_VAR*             var                 /**< variable to insert */
    )
 {
+   SCIP_VARSTATUS varstatus;
+   SCIP_VARTYPE vartype;
    int insertpos;
-   int intstart;
-   int implstart;
-   int contstart;
+   int t;
 
    assert(prob != NULL);
    assert(prob->vars != NULL);
    assert(prob->nvars < prob->varssize);
    assert(var != NULL);
    assert(SCIPvarGetProbindex(var) == -1);
-   assert(SCIPvarGetStatus(var) == SCIP_VARSTATUS_ORIGINAL
-      || SCIPvarGetStatus(var) == SCIP_VARSTATUS_LOOSE
-      || SCIPvarGetStatus(var) == SCIP_VARSTATUS_COLUMN);
+
+   varstatus = SCIPvarGetStatus(var);
+   assert(varstatus == SCIP_VARSTATUS_ORIGINAL
+      || varstatus == SCIP_VARSTATUS_LOOSE
+      || varstatus == SCIP_VARSTATUS_COLUMN);
    /* original variables cannot go into transformed problem and transformed variables cannot go into original problem */
-   assert((SCIPvarGetStatus(var) != SCIP_VARSTATUS_ORIGINAL) == prob->transformed);
+   assert((varstatus != SCIP_VARSTATUS_ORIGINAL) == prob->transformed);
 
-   /* insert variable in array */
-   insertpos = prob->nvars;
-   intstart = prob->nbinvars;
-   implstart = intstart + prob->nintvars;
-   contstart = implstart + prob->nimplvars;
+   vartype = SCIPvarGetType(var);
 
-   if( SCIPvarGetType(var) == SCIP_VARTYPE_CONTINUOUS )
-      prob->ncontvars++;
-   else
+   /* the vars array is partitioned into four contiguous blocks, ordered binary, integer, implicit, continuous; the
+    * start position of each block (with the total end as sentinel) is cached in prob->bucketstart
+    */
+   assert(prob->bucketstart[SCIP_VARTYPE_BINARY] == 0);
+   assert(prob->bucketstart[SCIP_VARTYPE_INTEGER] == prob->nbinvars);
+   assert(prob->bucketstart[SCIP_VARTYPE_IMPLINT] == prob->nbinvars + prob->nintvars);
+   assert(prob->bucketstart[SCIP_VARTYPE_CONTINUOUS] == prob->nbinvars + prob->nintvars + prob->nimplvars);
+   assert(prob->bucketstart[SCIP_VARTYPE_CONTINUOUS+1] == prob->nvars);
+
+   /* open a free slot at the end of the new variable's block by moving the first variable of each following block
+    * to the end of its own block; the following blocks are thereby shifted by one position
+    */
+   insertpos = prob->nvars;
+   for( t = SCIP_VARTYPE_CONTINUOUS; t > (int)vartype; --t )
    {
-      if( insertpos > contstart )
+      if( insertpos > prob->bucketstart[t] )
       {
-         prob->vars[insertpos] = prob->vars[contstart];
+         prob->vars[insertpos] = prob->vars[prob->bucketstart[t]];
+         prob->vartypes[insertpos] = prob->vartypes[prob->bucketstart[t]];
+         prob->varobjs[insertpos] = prob->varobjs[prob->bucketstart[t]];
          SCIPvarSetProbindex(prob->vars[insertpos], insertpos);
-         insertpos = contstart;
+         insertpos = prob->bucketstart[t];
       }
-      assert(insertpos == contstart);
-
-      if( SCIPvarGetType(var) == SCIP_VARTYPE_IMPLINT )
-         prob->nimplvars++;
-      else
-      {
-         if( insertpos > implstart )
-         {
-            prob->vars[insertpos] = prob->vars[implstart];
-            SCIPvarSetProbindex(prob->vars[insertpos], insertpos);
-            insertpos = implstart;
-         }
-         assert(insertpos == implstart);
-
-         if( SCIPvarGetType(var) == SCIP_VARTYPE_INTEGER )
-            prob->nintvars++;
-         else
-         {
-            assert(SCIPvarGetType(var) == SCIP_VARTYPE_BINARY);
-            if( insertpos > intstart )
-            {
-               prob->vars[insertpos] = prob->vars[intstart];
-               SCIPvarSetProbindex(prob->vars[insertpos], insertpos);
-               insertpos = intstart;
-            }
-            assert(insertpos == intstart);
+      assert(insertpos == prob->bucketstart[t]);
+   }
+   for( t = (int)vartype + 1; t <= SCIP_VARTYPE_CONTINUOUS + 1; ++t )
+      prob->bucketstart[t]++;
 
-            prob->nbinvars++;
-         }
-      }
+   switch( vartype )
+   {
+   case SCIP_VARTYPE_BINARY:
+      prob->nbinvars++;
+      break;
+   case SCIP_VARTYPE_INTEGER:
+      prob->nintvars++;
+      break;
+   case SCIP_VARTYPE_IMPLINT:
+      prob->nimplvars++;
+      break;
+   case SCIP_VARTYPE_CONTINUOUS:
+      prob->ncontvars++;
+      break;
+   default:
+      SCIPerrorMessage("unknown variable type\n");
+      SCIPABORT();
    }
    prob->nvars++;
 
    assert(prob->nvars == prob->nbinvars + prob->nintvars + prob->nimplvars + prob->ncontvars);
-   assert((SCIPvarGetType(var) == SCIP_VARTYPE_BINARY && insertpos == prob->nbinvars - 1)
-      || (SCIPvarGetType(var) == SCIP_VARTYPE_INTEGER && insertpos == prob->nbinvars + prob->nintvars - 1)
-      || (SCIPvarGetType(var) == SCIP_VARTYPE_IMPLINT && insertpos == prob->nbinvars + prob->nintvars + prob->nimplvars - 1)
-      || (SCIPvarGetType(var) == SCIP_VARTYPE_CONTINUOUS
+   assert((vartype == SCIP_VARTYPE_BINARY && insertpos == prob->nbinvars - 1)
+      || (vartype == SCIP_VARTYPE_INTEGER && insertpos == prob->nbinvars + prob->nintvars - 1)
+      || (vartype == SCIP_VARTYPE_IMPLINT && insertpos == prob->nbinvars + prob->nintvars + prob->nimplvars - 1)
+      || (vartype == SCIP_VARTYPE_CONTINUOUS
          && insertpos == prob->nbinvars + prob->nintvars + prob->nimplvars + prob->ncontvars - 1));
 
    prob->vars[insertpos] = var;
+   prob->vartypes[insertpos] = (uint8_t)vartype;
+   prob->varobjs[insertpos] = SCIPvarGetObj(var);
    SCIPvarSetProbindex(var, insertpos);
 
    /* update number of column variables in problem */
-   if( SCIPvarGetStatus(var) == SCIP_VARSTATUS_COLUMN )
+   if( varstatus == SCIP_VARSTATUS_COLUMN )
       prob->ncolvars++;
    assert(0 <= prob->ncolvars && prob->ncolvars <= prob->nvars);
 }
@@ -808,37 +1038,45 @@ SCIP_RETCODE probRemoveVar(
    SCIP_VAR*             var                 /**< variable to remove */
    )
 {
+   SCIP_VARTYPE vartype;
+   int probindex;
    int freepos;
-   int intstart;
-   int implstart;
-   int contstart;
+   int t;
 
    assert(prob != NULL);
    assert(var != NULL);
-   assert(SCIPvarGetProbindex(var) >= 0);
    assert(prob->vars != NULL);
-   assert(prob->vars[SCIPvarGetProbindex(var)] == var);
 
-   intstart = prob->nbinvars;
-   implstart = intstart + prob->nintvars;
-   contstart = implstart + prob->nimplvars;
+   probindex = SCIPvarGetProbindex(var);
+   assert(probindex >= 0);
+   assert(prob->vars[probindex] == var);
+   assert(prob->bucketstart[SCIP_VARTYPE_BINARY] == 0);
+   assert(prob->bucketstart[SCIP_VARTYPE_INTEGER] == prob->nbinvars);
+   assert(prob->bucketstart[SCIP_VARTYPE_IMPLINT] == prob->nbinvars + prob->nintvars);
+   assert(prob->bucketstart[SCIP_VARTYPE_CONTINUOUS] == prob->nbinvars + prob->nintvars + prob->nimplvars);
+   assert(prob->bucketstart[SCIP_VARTYPE_CONTINUOUS+1] == prob->nvars);
 
-   switch( SCIPvarGetType(var) )
+   vartype = SCIPvarGetType(var);
+
+   switch( vartype )
    {
    case SCIP_VARTYPE_BINARY:
-      assert(0 <= SCIPvarGetProbindex(var) && SCIPvarGetProbindex(var) < intstart);
+      assert(probindex < prob->bucketstart[SCIP_VARTYPE_INTEGER]);
       prob->nbinvars--;
       break;
    case SCIP_VARTYPE_INTEGER:
-      assert(intstart <= SCIPvarGetProbindex(var) && SCIPvarGetProbindex(var) < implstart);
+      assert(prob->bucketstart[SCIP_VARTYPE_INTEGER] <= probindex
+         && probindex < prob->bucketstart[SCIP_VARTYPE_IMPLINT]);
       prob->nintvars--;
       break;
    case SCIP_VARTYPE_IMPLINT:
-      assert(implstart <= SCIPvarGetProbindex(var) && SCIPvarGetProbindex(var) < contstart);
+      assert(prob->bucketstart[SCIP_VARTYPE_IMPLINT] <= probindex
+         && probindex < prob->bucketstart[SCIP_VARTYPE_CONTINUOUS]);
       prob->nimplvars--;
       break;
    case SCIP_VARTYPE_CONTINUOUS:
-      assert(contstart <= SCIPvarGetProbindex(var) && SCIPvarGetProbindex(var) < prob->nvars);
+      assert(prob->bucketstart[SCIP_VARTYPE_CONTINUOUS] <= probindex
+         && probindex < prob->nvars);
       prob->ncontvars--;
       break;
    default:
@@ -847,38 +1085,27 @@ SCIP_RETCODE probRemoveVar(
       return SCIP_INVALIDDATA;  /*lint !e527*/
    }
 
-   /* move last binary, last integer, last implicit, and last continuous variable forward to fill the free slot */
-   freepos = SCIPvarGetProbindex(var);
-   if( freepos < intstart-1 )
-   {
-      /* move last binary variable to free slot */
-      prob->vars[freepos] = prob->vars[intstart-1];
-      SCIPvarSetProbindex(prob->vars[freepos], freepos);
-      freepos = intstart-1;
-   }
-   if( freepos < implstart-1 )
-   {
-      /* move last integer variable to free slot */
-      prob->vars[freepos] = prob->vars[implstart-1];
-      SCIPvarSetProbindex(prob->vars[freepos], freepos);
-      freepos = implstart-1;
-   }
-   if( freepos < contstart-1 )
-   {
-      /* move last implicit integer variable to free slot */
-      prob->vars[freepos] = prob->vars[contstart-1];
-      SCIPvarSetProbindex(prob->vars[freepos], freepos);
-      freepos = contstart-1;
-   }
-   if( freepos < prob->nvars-1 )
+   /* fill the free slot by moving the last variable of the removed variable's block into it, then cascade the free
+    * slot through the end of each following block; the following blocks are thereby shifted by one position
+    */
+   freepos = probindex;
+   for( t = (int)vartype; t <= SCIP_VARTYPE_CONTINUOUS; ++t )
    {
-      /* move last implicit integer variable to free slot */
-      prob->vars[freepos] = prob->vars[prob->nvars-1];
-      SCIPvarSetProbindex(prob->vars[freepos], freepos);
-      freepos = prob->nvars-1;
+      if( freepos < prob->bucketstart[t+1]-1 )
+      {
+         /* move last variable of the block to the free slot */
+         prob->vars[freepos] = prob->vars[prob->bucketstart[t+1]-1];
+         prob->vartypes[freepos] = prob->vartypes[prob->bucketstart[t+1]-1];
+         prob->varobjs[freepos] = prob->varobjs[prob->bucketstart[t+1]-1];
+         SCIPvarSetProbindex(prob->vars[freepos], freepos);
+         freepos = prob->bucketstart[t+1]-1;
+      }
    }
    assert(freepos == prob->nvars-1);
 
+   for( t = (int)vartype + 1; t <= SCIP_VARTYPE_CONTINUOUS + 1; ++t )
+      prob->bucketstart[t]--;
+
    prob->nvars--;
    assert(prob->nvars == prob->nbinvars + prob->nintvars + prob->nimplvars + prob->ncontvars);
 
@@ -903,7 +1130,7 @@ SCIP_RETCODE SCIPprobAddVarName(
 
    if( varHasName(var) && prob->varnames != NULL )
    {
-      SCIP_CALL( SCIPhashtableInsert(prob->varnames, (void*)var) );
+      SCIP_CALL( SCIPhashtableInsertKeyval(prob->varnames, (void*)var, var->namehash) );
    }
 
    return SCIP_OKAY;
@@ -917,8 +1144,13 @@ SCIP_RETCODE SCIPprobRemoveVarName(
 {
    if( varHasName(var) && prob->varnames != NULL )
    {
-      assert(SCIPhashtableExists(prob->varnames, (void*)var));
-      SCIP_CALL( SCIPhashtableRemove(prob->varnames, (void*)var) );
+      SCIP_Bool removed;
+
+      /* if another variable with the same name shadowed this one in the table, the entry belongs to that variable and
+       * must stay; duplicate names are not rejected anywhere, so this is a legal state
+       */
+      SCIP_CALL( SCIPhashtableRemoveIfExists(prob->varnames, (void*)var, var->namehash, &removed) );
+      SCIP_UNUSED(removed);
    }
 
    return SCIP_OKAY;
@@ -936,15 +1168,19 @@ SCIP_RETCODE SCIPprobAddVar(
    SCIP_VAR*             var                 /**< variable to add */
    )
 {
+   SCIP_VARSTATUS varstatus;
+
    assert(prob != NULL);
    assert(set != NULL);
    assert(var != NULL);
    assert(SCIPvarGetProbindex(var) == -1);
-   assert(SCIPvarGetStatus(var) == SCIP_VARSTATUS_ORIGINAL
-      || SCIPvarGetStatus(var) == SCIP_VARSTATUS_LOOSE
-      || SCIPvarGetStatus(var) == SCIP_VARSTATUS_COLUMN);
+
+   varstatus = SCIPvarGetStatus(var);
+   assert(varstatus == SCIP_VARSTATUS_ORIGINAL
+      || varstatus == SCIP_VARSTATUS_LOOSE
+      || varstatus == SCIP_VARSTATUS_COLUMN);
    /* original variables cannot go into transformed problem and transformed variables cannot go into original problem */
-   assert((SCIPvarGetStatus(var) != SCIP_VARSTATUS_ORIGINAL) == prob->transformed);
+   assert((varstatus != SCIP_VARSTATUS_ORIGINAL) == prob->transformed);
 
 #ifndef NDEBUG
    /* check if we add this variables to the same scip, where we created it */
@@ -968,7 +1204,7 @@ SCIP_RETCODE SCIPprobAddVar(
    SCIP_CALL( SCIPprobAddVarName(prob, var) );
 
    /* update branching candidates and pseudo and loose objective value in the LP */
-   if( SCIPvarGetStatus(var) != SCIP_VARSTATUS_ORIGINAL )
+   if( varstatus != SCIP_VARSTATUS_ORIGINAL )
    {
       SCIP_CALL( SCIPbranchcandUpdateVar(branchcand, set, var) );
       SCIP_CALL( SCIPlpUpdateAddVar(lp, set, var) );
@@ -979,14 +1215,19 @@ SCIP_RETCODE SCIPprobAddVar(
 
    if( prob->transformed )
    {
-      SCIP_EVENT* event;
+      /* issue VARADDED event, unless nobody catches it; this saves the event allocation for every variable added
+       * during problem transformation
+       */
+      if( eventfilter->len > 0 && (eventfilter->eventmask & SCIP_EVENTTYPE_VARADDED) != 0 )
+      {
+         SCIP_EVENT* event;
 
-      /* issue VARADDED event */
-      SCIP_CALL( SCIPeventCreateVarAdded(&event, blkmem, var) );
-      SCIP_CALL( SCIPeventqueueAdd(eventqueue, blkmem, set, NULL, NULL, NULL, eventfilter, &event) );
+         SCIP_CALL( SCIPeventCreateVarAdded(&event, blkmem, var) );
+         SCIP_CALL( SCIPeventqueueAdd(eventqueue, blkmem, set, NULL, NULL, NULL, eventfilter, &event) );
+      }
 
       /* update the number of variables with non-zero objective coefficient */
-      SCIPprobUpdateNObjVars(prob, set, 0.0, SCIPvarGetObj(var));
+      SCIPprobUpdateNObjVars(prob, set, var, 0.0, SCIPvarGetObj(var));
 
       /* SCIP assumes that the status of objisintegral does not change after transformation. Thus, the objective of all
        * new variables beyond that stage has to be compatible. */
@@ -1058,6 +1299,13 @@ SCIP_RETCODE SCIPprobDelVar(
    return SCIP_OKAY;
 }
 
+/** comparison method for sorting variables by their problem index */
+static
+SCIP_DECL_SORTPTRCOMP(varCompProbindex)
+{
+   return SCIPvarGetProbindex((SCIP_VAR*)elem1) - SCIPvarGetProbindex((SCIP_VAR*)elem2);
+}
+
 /** actually removes the deleted variables from the problem and releases them */
 SCIP_RETCODE SCIPprobPerformVarDeletions(
    SCIP_PROB*            prob,               /**< problem data */
@@ -1086,6 +1334,12 @@ SCIP_RETCODE SCIPprobPerformVarDeletions(
       }
    }
 
+   /* process the variables in non-increasing probindex order, so that the tail swaps performed by probRemoveVar()
+    * only move variables that are not marked for deletion themselves
+    */
+   if( prob->ndeletedvars > 1 )
+      SCIPsortDownPtr((void**)prob->deletedvars, varCompProbindex, prob->ndeletedvars);
+
    for( i = 0; i < prob->ndeletedvars; ++i )
    {
       SCIP_VAR* var;
@@ -1118,7 +1372,7 @@ SCIP_RETCODE SCIPprobPerformVarDeletions(
 
          /* update the number of variables with non-zero objective coefficient */
          if( prob->transformed )
-            SCIPprobUpdateNObjVars(prob, set, SCIPvarGetObj(var), 0.0);
+            SCIPprobUpdateNObjVars(prob, set, var, SCIPvarGetObj(var), 0.0);
 
          /* release variable */
          SCIP_CALL( SCIPvarRelease(&prob->deletedvars[i], blkmem, set, eventqueue, lp) );
@@ -1129,6 +1383,19 @@ SCIP_RETCODE SCIPprobPerformVarDeletions(
    return SCIP_OKAY;
 }
 
+/** returns whether an objective coefficient may render the objective value fractional: it is non-zero and either
+ *  fractional itself or attached to a variable that can take fractional values
+ */
+static
+SCIP_Bool probIsObjCoefFractional(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_Real             obj,                /**< objective coefficient */
+   SCIP_VARTYPE          vartype             /**< type of the corresponding variable */
+   )
+{
+   return !SCIPsetIsZero(set, obj) && (!SCIPsetIsIntegral(set, obj) || vartype == SCIP_VARTYPE_CONTINUOUS);
+}
+
 /** changes the type of a variable in the problem */
 SCIP_RETCODE SCIPprobChgVarType(
    SCIP_PROB*            prob,               /**< problem data */
@@ -1154,6 +1421,12 @@ SCIP_RETCODE SCIPprobChgVarType(
    if( SCIPvarGetType(var) == vartype )
       return SCIP_OKAY;
 
+   /* changing between a continuous and an integral type may change whether the variable's objective coefficient
+    * keeps the objective value from being provably integral
+    */
+   if( prob->transformed && probIsObjCoefFractional(set, SCIPvarGetObj(var), SCIPvarGetType(var)) )
+      prob->nfracobjvars--;
+
    /* temporarily remove variable from branching candidates */
    if( branchcand != NULL )
    {
@@ -1169,6 +1442,9 @@ SCIP_RETCODE SCIPprobChgVarType(
    /* reinsert variable into problem */
    probInsertVar(prob, var);
 
+   if( prob->transformed && probIsObjCoefFractional(set, SCIPvarGetObj(var), vartype) )
+      prob->nfracobjvars++;
+
    /* update branching candidates */
    if( branchcand != NULL )
    {
@@ -1242,10 +1518,13 @@ SCIP_RETCODE SCIPprobAddConsName(
    SCIP_CONS*            cons                /**< constraint */
    )
 {
-   /* add constraint's name to the namespace */
-   if( consHasName(cons) && prob->consnames != NULL )
+   /* add constraint's name to the namespace; skip the hash insert if the constraint is still registered from a
+    * previous addition, e.g., when it is re-added after a temporary removal
+    */
+   if( !cons->inconsnames && consHasName(cons) && prob->consnames != NULL )
    {
-      SCIP_CALL( SCIPhashtableInsert(prob->consnames, (void*)cons) );
+      SCIP_CALL( SCIPhashtableInsertKeyval(prob->consnames, (void*)cons, cons->namehash) );
+      cons->inconsnames = TRUE;
    }
 
    return SCIP_OKAY;
@@ -1257,15 +1536,18 @@ SCIP_RETCODE SCIPprobRemoveConsName(
    SCIP_CONS*            cons                /**< constraint */
    )
 {
-   /* remove constraint's name from the namespace */
-   if( consHasName(cons) && prob->consnames != NULL )
+   /* remove constraint's name from the namespace, if the namespace still maps the name to this constraint; the
+    * registration flag gives a probe-free exit for constraints that were never registered
+    */
+   if( cons->inconsnames && prob->consnames != NULL )
    {
-      SCIP_CONS* currentcons;
-      currentcons = (SCIP_CONS*)SCIPhashtableRetrieve(prob->consnames, (void*)(cons->name));
-      if( currentcons == cons )
-      {
-         SCIP_CALL( SCIPhashtableRemove(prob->consnames, (void*)cons) );
-      }
+      SCIP_Bool removed;
+
+      assert(consHasName(cons));
+
+      SCIP_CALL( SCIPhashtableRemoveIfExists(prob->consnames, (void*)cons, cons->namehash, &removed) );
+      SCIP_UNUSED(removed);
+      cons->inconsnames = FALSE;
    }
 
    return SCIP_OKAY;
@@ -1360,6 +1642,11 @@ SCIP_RETCODE SCIPprobDelCons(
    assert(prob->conss != NULL);
    assert(prob->conss[cons->addarraypos] == cons);
 
+   /* the last constraint of the array is moved into the free slot below and gets its array position updated; request
+    * its cache line early, so that the deactivation work hides the latency of this otherwise random access
+    */
+   SCIP_PREFETCH_WRITE(prob->conss[prob->nconss-1]);
+
    /* if the problem is the transformed problem, deactivate and unlock constraint */
    if( prob->transformed )
    {
@@ -1425,6 +1712,7 @@ void SCIPprobSetObjsense(
    assert(objsense == SCIP_OBJSENSE_MAXIMIZE || objsense == SCIP_OBJSENSE_MINIMIZE);
 
    prob->objsense = objsense;
+   prob->objsensereal = (objsense == SCIP_OBJSENSE_MINIMIZE ? 1.0 : -1.0);
 }
 
 /** adds value to objective offset */
@@ -1489,9 +1777,6 @@ SCIP_RETCODE SCIPprobCheckObjIntegral(
    SCIP_EVENTQUEUE*      eventqueue          /**< event queue */
    )
 {
-   SCIP_Real obj;
-   int v;
-
    assert(transprob != NULL);
    assert(origprob != NULL);
 
@@ -1507,27 +1792,33 @@ SCIP_RETCODE SCIPprobCheckObjIntegral(
    if( !SCIPsetIsIntegral(set, transprob->objoffset) )
       return SCIP_OKAY;
 
-   /* scan through the variables */
-   for( v = 0; v < transprob->nvars; ++v )
+#ifndef NDEBUG
+   /* cross-check the incrementally maintained counter against a full rescan of the parallel arrays */
    {
-      /* get objective value of variable */
-      obj = SCIPvarGetObj(transprob->vars[v]);
+      SCIP_Real eps;
+      int nfracobjvars;
+      int v;
 
-      /* check, if objective value is non-zero */
-      if( !SCIPsetIsZero(set, obj) )
+      eps = SCIPsetEpsilon(set);
+      nfracobjvars = 0;
+      for( v = 0; v < transprob->nvars; ++v )
       {
-         /* if variable's objective value is fractional, the problem's objective value may also be fractional */
-         if( !SCIPsetIsIntegral(set, obj) )
-            break;
+         SCIP_Real obj;
 
-         /* if variable with non-zero objective value is continuous, the problem's objective value may be fractional */
-         if( SCIPvarGetType(transprob->vars[v]) == SCIP_VARTYPE_CONTINUOUS )
-            break;
+         obj = transprob->varobjs[v];
+         assert(obj == SCIPvarGetObj(transprob->vars[v])); /*lint !e777*/
+         if( !EPSZ(obj, eps)
+            && (!EPSISINT(obj, eps) || transprob->vartypes[v] == SCIP_VARTYPE_CONTINUOUS) )
+            nfracobjvars++;
       }
+      assert(nfracobjvars == transprob->nfracobjvars);
    }
+#endif
 
-   /* objective value is integral, if the variable loop scanned all variables */
-   if( v == transprob->nvars )
+   /* the objective value is integral, if no variable with a possibly fractional objective contribution is left; the
+    * counter is maintained on every objective and type change, so the former variable scan is no longer needed
+    */
+   if( transprob->nfracobjvars == 0 )
    {
       transprob->objisintegral = TRUE;
 
@@ -1542,11 +1833,26 @@ SCIP_RETCODE SCIPprobCheckObjIntegral(
 void SCIPprobUpdateNObjVars(
    SCIP_PROB*            prob,               /**< problem data */
    SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_VAR*             var,                /**< variable whose objective value changed */
    SCIP_Real             oldobj,             /**< old objective value for variable */
    SCIP_Real             newobj              /**< new objective value for variable */
    )
 {
+   SCIP_VARTYPE vartype;
+
    assert(prob->transformed);
+   assert(var != NULL);
+
+   /* keep the parallel objective array in sync; the variable may already have been removed from the vars array */
+   if( SCIPvarGetProbindex(var) >= 0 )
+      prob->varobjs[SCIPvarGetProbindex(var)] = newobj;
+
+   vartype = SCIPvarGetType(var);
+   if( probIsObjCoefFractional(set, oldobj, vartype) )
+      prob->nfracobjvars--;
+   if( probIsObjCoefFractional(set, newobj, vartype) )
+      prob->nfracobjvars++;
+   assert(prob->nfracobjvars >= 0);
 
    if( !SCIPsetIsZero(set, oldobj) )
       prob->nobjvars--;
@@ -1624,8 +1930,11 @@ SCIP_RETCODE SCIPprobScaleObj(
    {
       SCIP_Real obj;
 
-      /* get objective value of variable; it it is non-zero, no scaling can be applied */
-      obj = SCIPvarGetObj(transprob->vars[v]);
+      /* get objective value of variable from the parallel objective array, which keeps the scan off the variable
+       * structs; if it is non-zero, no scaling can be applied
+       */
+      obj = transprob->varobjs[v];
+      assert(obj == SCIPvarGetObj(transprob->vars[v])); /*lint !e777*/
       if( !SCIPsetIsZero(set, obj) )
          break;
    }
@@ -1640,9 +1949,8 @@ SCIP_RETCODE SCIPprobScaleObj(
       /* get temporary memory */
       SCIP_CALL( SCIPsetAllocBufferArray(set, &objvals, nints) );
 
-      /* get objective values of integer variables */
-      for( v = 0; v < nints; ++v )
-         objvals[v] = SCIPvarGetObj(transprob->vars[v]);
+      /* get objective values of integer variables; they are a prefix of the parallel objective array */
+      BMScopyMemoryArray(objvals, transprob->varobjs, nints);
 
       /* calculate integral scalar */
       SCIP_CALL( SCIPcalcIntegralScalar(objvals, nints, -SCIPsetEpsilon(set), +SCIPsetEpsilon(set), OBJSCALE_MAXDNOM, OBJSCALE_MAXSCALE,
@@ -1691,7 +1999,7 @@ SCIP_RETCODE SCIPprobScaleObj(
                   SCIP_Real newobj;
 
                   /* check if new obj is really integral */
-                  newobj = intscalar * SCIPvarGetObj(transprob->vars[v]);
+                  newobj = intscalar * transprob->varobjs[v];
                   if( !SCIPsetIsFeasIntegral(set, newobj) )
                      break;
                   objvals[v] = SCIPsetFeasFloor(set, newobj);
@@ -1740,8 +2048,16 @@ void SCIPprobStoreRootSol(
 
    if( roothaslp )
    {
+      /* the variable structs are scattered in block memory; prefetch a few positions ahead so the stores on the
+       * current variable overlap with fetching the upcoming ones
+       */
       for( v = 0; v < prob->nvars; ++v )
+      {
+         if( v + PROB_PREFETCHDIST < prob->nvars )
+            SCIP_PREFETCH_WRITE(prob->vars[v + PROB_PREFETCHDIST]);
+
          SCIPvarStoreRootSol(prob->vars[v], roothaslp);
+      }
 
       SCIPlpSetRootLPIsRelax(lp, SCIPlpIsRelax(lp));
       SCIPlpStoreRootObjval(lp, set, prob);
@@ -1871,16 +2187,23 @@ SCIP_RETCODE SCIPprobInitSolve(
    assert(prob->transformed);
    assert(set != NULL);
 
-   /* reset constraint's ages */
-   for( c = 0; c < prob->nconss; ++c )
+   /* reset the constraints' ages and initialize the variables for solving in a single interleaved pass, so that on
+    * large problems both arrays are streamed once instead of two back-to-back walks through the whole memory
+    */
+   for( c = 0, v = 0; c < prob->nconss || v < prob->nvars; )
    {
-      SCIP_CALL( SCIPconsResetAge(prob->conss[c], set) );
+      if( c < prob->nconss )
+      {
+         SCIP_CALL( SCIPconsResetAge(prob->conss[c], set) );
+         ++c;
+      }
+      if( v < prob->nvars )
+      {
+         SCIPvarInitSolve(prob->vars[v]);
+         ++v;
+      }
    }
 
-   /* initialize variables for solving */
-   for( v = 0; v < prob->nvars; ++v )
-      SCIPvarInitSolve(prob->vars[v]);
-
    /* call user data function */
    if( prob->probinitsol != NULL )
    {
@@ -1977,7 +2300,8 @@ SCIP_RETCODE SCIPprobSetName(
    assert(prob != NULL);
 
    BMSfreeMemoryArray(&(prob->name));
-   SCIP_ALLOC( BMSduplicateMemoryArray(&(prob->name), name, strlen(name)+1) );
+   prob->namelen = (int) strlen(name);
+   SCIP_ALLOC( BMSduplicateMemoryArray(&(prob->name), name, prob->namelen+1) );
 
    return SCIP_OKAY;
 }
@@ -2111,18 +2435,22 @@ SCIP_Real SCIPprobExternObjval(
    SCIP_Real             objval              /**< internal objective value */
    )
 {
+   SCIP_Real inf;
+
    assert(set != NULL);
    assert(origprob != NULL);
    assert(transprob != NULL);
    assert(transprob->transformed);
    assert(transprob->objscale > 0.0);
 
-   if( SCIPsetIsInfinity(set, objval) )
-      return (SCIP_Real)transprob->objsense * SCIPsetInfinity(set);
-   else if( SCIPsetIsInfinity(set, -objval) )
-      return -(SCIP_Real)transprob->objsense * SCIPsetInfinity(set);
-   else
-      return (SCIP_Real)transprob->objsense * transprob->objscale * (objval + transprob->objoffset) + origprob->objoffset;
+   /* infinite values of either sign map to infinity of the corresponding direction; folding both checks into a single
+    * test on the absolute value keeps one well-predicted branch in front of the common finite case
+    */
+   inf = SCIPsetInfinity(set);
+   if( SCIP_UNLIKELY(REALABS(objval) >= inf) )
+      return transprob->objsensereal * (objval > 0.0 ? inf : -inf);
+
+   return transprob->objsensereal * transprob->objscale * (objval + transprob->objoffset) + origprob->objoffset;
 }
 
 /** returns the internal value of the given external objective value */
@@ -2133,18 +2461,20 @@ SCIP_Real SCIPprobInternObjval(
    SCIP_Real             objval              /**< external objective value */
    )
 {
+   SCIP_Real inf;
+
    assert(set != NULL);
    assert(origprob != NULL);
    assert(transprob != NULL);
    assert(transprob->transformed);
    assert(transprob->objscale > 0.0);
 
-   if( SCIPsetIsInfinity(set, objval) )
-      return (SCIP_Real)transprob->objsense * SCIPsetInfinity(set);
-   else if( SCIPsetIsInfinity(set, -objval) )
-      return -(SCIP_Real)transprob->objsense * SCIPsetInfinity(set);
-   else
-      return (SCIP_Real)transprob->objsense * (objval - origprob->objoffset)/transprob->objscale - transprob->objoffset;
+   /* infinite values are mapped as in SCIPprobExternObjval() */
+   inf = SCIPsetInfinity(set);
+   if( SCIP_UNLIKELY(REALABS(objval) >= inf) )
+      return transprob->objsensereal * (objval > 0.0 ? inf : -inf);
+
+   return transprob->objsensereal * (objval - origprob->objoffset)/transprob->objscale - transprob->objoffset;
 }
 
 /** returns variable of the problem with given name */
@@ -2163,6 +2493,27 @@ SCIP_VAR* SCIPprobFindVar(
       return NULL;
    }
 
+   /* for small problems a scan through the contiguous variable arrays is cheaper than a hash probe; unnamed
+    * variables are not registered in the namespace, so the empty name must not match them
+    */
+   if( name[0] != '\0' && prob->nvars + prob->nfixedvars <= PROB_SMALLNAMETABLE )
+   {
+      int v;
+
+      for( v = 0; v < prob->nvars; ++v )
+      {
+         if( strcmp(SCIPvarGetName(prob->vars[v]), name) == 0 )
+            return prob->vars[v];
+      }
+      for( v = 0; v < prob->nfixedvars; ++v )
+      {
+         if( strcmp(SCIPvarGetName(prob->fixedvars[v]), name) == 0 )
+            return prob->fixedvars[v];
+      }
+
+      return NULL;
+   }
+
    return (SCIP_VAR*)(SCIPhashtableRetrieve(prob->varnames, (char*)name));
 }
 
@@ -2182,6 +2533,23 @@ SCIP_CONS* SCIPprobFindCons(
       return NULL;
    }
 
+   /* for small problems a scan through the contiguous constraint array is cheaper than a hash probe (cf.
+    * SCIPprobFindVar()); constraints whose name was shadowed by a later insert keep their inconsnames flag unset
+    * only if they were never registered, so the scan skips unregistered constraints to match the hash semantics
+    */
+   if( name[0] != '\0' && prob->nconss <= PROB_SMALLNAMETABLE )
+   {
+      int c;
+
+      for( c = 0; c < prob->nconss; ++c )
+      {
+         if( prob->conss[c]->inconsnames && strcmp(prob->conss[c]->name, name) == 0 )
+            return prob->conss[c];
+      }
+
+      return NULL;
+   }
+
    return (SCIP_CONS*)(SCIPhashtableRetrieve(prob->consnames, (char*)name));
 }
 
@@ -2194,14 +2562,17 @@ void SCIPprobPrintPseudoSol(
 {
    SCIP_VAR* var;
    SCIP_Real solval;
+   SCIP_Real eps;
    int v;
 
+   /* hoist the tolerance, so that skipping the zero entries of the pseudo solution costs a single compare */
+   eps = SCIPsetEpsilon(set);
    for( v = 0; v < prob->nvars; ++v )
    {
       var = prob->vars[v];
       assert(var != NULL);
       solval = SCIPvarGetPseudoSol(var);
-      if( !SCIPsetIsZero(set, solval) )
+      if( !EPSZ(solval, eps) )
          SCIPmessagePrintInfo(messagehdlr, " <%s>=%.15g", SCIPvarGetName(var), solval);
    }
    SCIPmessagePrintInfo(messagehdlr, "\n");
@@ -2317,7 +2688,7 @@ SCIP_Real SCIPprobGetObjlim(
    assert(prob != NULL);
    assert(set != NULL);
 
-   return prob->objlim >= SCIP_INVALID ? (SCIP_Real)(prob->objsense) * SCIPsetInfinity(set) : prob->objlim;
+   return prob->objlim >= SCIP_INVALID ? prob->objsensereal * SCIPsetInfinity(set) : prob->objlim;
 }
 
 /** gets user problem data */
@@ -450,6 +450,7 @@ SCIP_Real SCIPprobGetAbsMaxObjCoef(
 void SCIPprobUpdateNObjVars(
    SCIP_PROB*            prob,               /**< problem data */
    SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_VAR*             var,                /**< variable whose objective value changed */
    SCIP_Real             oldobj,             /**< old objective value for variable */
    SCIP_Real             newobj              /**< new objective value for variable */
    );
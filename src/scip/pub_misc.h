@@ -604,6 +604,30 @@ SCIP_RETCODE SCIPhashtableRemove(
    void*                 element             /**< element to remove from the table */
    );
 
+/** inserts element in hash table using a precomputed key value, thereby skipping the hashkeyval callback
+ *
+ *  @note multiple inserts of same element override the previous entry
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPhashtableInsertKeyval(
+   SCIP_HASHTABLE*       hashtable,          /**< hash table */
+   void*                 element,            /**< element to insert into the table */
+   uint64_t              keyval              /**< precomputed key value of the element's key */
+   );
+
+/** removes element from the hash table if its key currently maps to exactly this element
+ *
+ *  In contrast to a retrieve followed by a remove, this performs only a single probe walk. The table may store a
+ *  different element under an equal key; in this case the entry is left untouched and *removed is set to FALSE.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPhashtableRemoveIfExists(
+   SCIP_HASHTABLE*       hashtable,          /**< hash table */
+   void*                 element,            /**< element to remove from the table */
+   uint64_t              keyval,             /**< precomputed key value of the element's key */
+   SCIP_Bool*            removed             /**< pointer to store whether the element was removed */
+   );
+
 /** removes all elements of the hash table */
 SCIP_EXPORT
 void SCIPhashtableRemoveAll(
@@ -914,6 +914,23 @@ SCIP_RETCODE SCIPpermuteProb(
       permuted = TRUE;
    }
 
+   /* the permutations above shuffle the problem's vars array in place, so the parallel type and objective arrays must
+    * be rebuilt to stay aligned with the new variable positions
+    */
+   if( permuted )
+   {
+      SCIP_PROB* prob;
+
+      prob = SCIPisTransformed(scip) ? scip->transprob : scip->origprob;
+      assert(prob->vars == vars);
+
+      for( j = 0; j < nvars; ++j )
+      {
+         prob->vartypes[j] = (uint8_t) SCIPvarGetType(vars[j]);
+         prob->varobjs[j] = SCIPvarGetObj(vars[j]);
+      }
+   }
+
    if( permuted && SCIPisTransformed(scip) )
    {
       assert(!SCIPprobIsPermuted(scip->transprob));
@@ -1161,7 +1178,7 @@ SCIP_RETCODE SCIPchgReoptObjective(
 
    /* reset objective data of original problem */
    scip->origprob->objscale = 1.0;
-   scip->origprob->objsense = objsense;
+   SCIPprobSetObjsense(scip->origprob, objsense);
    scip->origprob->objoffset = 0.0;
    scip->origprob->objisintegral = FALSE;
 
@@ -1169,7 +1186,7 @@ SCIP_RETCODE SCIPchgReoptObjective(
    {
       /* reset objective data of transformed problem */
       scip->transprob->objscale = 1.0;
-      scip->transprob->objsense = objsense;
+      SCIPprobSetObjsense(scip->transprob, objsense);
       scip->transprob->objoffset = 0.0;
       scip->transprob->objisintegral = FALSE;
    }
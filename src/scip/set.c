@@ -61,6 +61,14 @@
 #include "scip/pub_nlpi.h"
 #include "scip/struct_scip.h" /* for SCIPsetPrintDebugMessage() */
 
+/* the numerical tolerances are deliberately the first members of SCIP_Set so that the epsilon-comparison macros only
+ * touch the first cache line of the struct; fail the build if a later reorder silently loses that property
+ */
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+_Static_assert(offsetof(SCIP_SET, num_infinity) == 0, "numerical tolerances must lead SCIP_Set");
+_Static_assert(offsetof(SCIP_SET, num_feastol) < 64, "hot tolerances must fit in the first cache line of SCIP_Set");
+#endif
+
 /*
  * Default settings
  */
@@ -528,6 +536,27 @@ int calcGrowSize(
 
    if( growfac == 1.0 )
       size = MAX(initsize, num);
+#ifdef __GNUC__
+   else if( growfac == 2.0 )  /*lint !e777*/
+   {
+      initsize = MAX(initsize, 4);
+      size = initsize;
+
+      if( num > size )
+      {
+         /* the recurrence size <- 2*size + initsize produces exactly the values (2^(k+1) - 1) * initsize, so the
+          * smallest member >= num can be found with a single bit scan instead of iterating the multiplication;
+          * the tree and path arrays use this growing factor by default
+          */
+         unsigned int factor;
+         SCIP_Longint longsize;
+
+         factor = (unsigned int)((num - 1) / initsize) + 1;
+         longsize = (((SCIP_Longint)1 << (32 - __builtin_clz(factor))) - 1) * initsize;
+         size = longsize > INT_MAX ? num : (int)longsize;
+      }
+   }
+#endif
    else
    {
       int oldsize;
@@ -1097,16 +1126,23 @@ SCIP_RETCODE SCIPsetCreate(
    assert(set != NULL);
    assert(scip != NULL);
 
-   SCIP_ALLOC( BMSallocMemory(set) );
+   SCIP_ALLOC( BMSallocBlockMemory(blkmem, set) );
 
    (*set)->stage = SCIP_STAGE_INIT;
    (*set)->scip = scip;
+   (*set)->blkmem = blkmem;
    (*set)->buffer = SCIPbuffer(scip);
    (*set)->cleanbuffer = SCIPcleanbuffer(scip);
 
    SCIP_CALL( SCIPparamsetCreate(&(*set)->paramset, blkmem) );
 
+   /* invalidate the cached array grow size table; it is built on first use */
+   (*set)->mem_narraygrowtable = 0;
+   (*set)->mem_arraygrowtablefac = 0.0;
+   (*set)->mem_arraygrowtableinit = -1;
+
    (*set)->readers = NULL;
+   (*set)->readers_name = NULL;
    (*set)->nreaders = 0;
    (*set)->readerssize = 0;
    (*set)->pricers = NULL;
@@ -1119,8 +1155,12 @@ SCIP_RETCODE SCIPsetCreate(
    (*set)->conshdlrs_sepa = NULL;
    (*set)->conshdlrs_enfo = NULL;
    (*set)->conshdlrs_include = NULL;
+   (*set)->conshdlrs_name = NULL;
+   BMSclearMemoryArray((*set)->conshdlrcache, 64);
+   BMSclearMemoryArray((*set)->conshdlrcachekey, 64);
    (*set)->nconshdlrs = 0;
    (*set)->conshdlrssize = 0;
+   (*set)->conshdlrneedsconsmask = 0;
    (*set)->conflicthdlrs = NULL;
    (*set)->nconflicthdlrs = 0;
    (*set)->conflicthdlrssize = 0;
@@ -1183,6 +1223,7 @@ SCIP_RETCODE SCIPsetCreate(
    (*set)->neventhdlrs = 0;
    (*set)->eventhdlrssize = 0;
    (*set)->nodesels = NULL;
+   (*set)->nodesels_name = NULL;
    (*set)->nnodesels = 0;
    (*set)->nodeselssize = 0;
    (*set)->nodesel = NULL;
@@ -1195,6 +1236,7 @@ SCIP_RETCODE SCIPsetCreate(
    (*set)->banditvtablessize = 0;
    (*set)->nbanditvtables = 0;
    (*set)->disps = NULL;
+   (*set)->disps_name = NULL;
    (*set)->ndisps = 0;
    (*set)->dispssize = 0;
    (*set)->tables = NULL;
@@ -2725,7 +2767,8 @@ SCIP_RETCODE SCIPsetFree(
    {
       SCIP_CALL( SCIPreaderFree(&(*set)->readers[i], *set) );
    }
-   BMSfreeMemoryArrayNull(&(*set)->readers);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*set)->readers, (*set)->readerssize);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*set)->readers_name, (*set)->readerssize);
 
    /* free variable pricers */
    for( i = 0; i < (*set)->npricers; ++i )
@@ -2746,10 +2789,11 @@ SCIP_RETCODE SCIPsetFree(
    {
       SCIP_CALL( SCIPconshdlrFree(&(*set)->conshdlrs[i], *set) );
    }
-   BMSfreeMemoryArrayNull(&(*set)->conshdlrs);
-   BMSfreeMemoryArrayNull(&(*set)->conshdlrs_sepa);
-   BMSfreeMemoryArrayNull(&(*set)->conshdlrs_enfo);
-   BMSfreeMemoryArrayNull(&(*set)->conshdlrs_include);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*set)->conshdlrs, (*set)->conshdlrssize);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*set)->conshdlrs_sepa, (*set)->conshdlrssize);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*set)->conshdlrs_enfo, (*set)->conshdlrssize);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*set)->conshdlrs_include, (*set)->conshdlrssize);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*set)->conshdlrs_name, (*set)->conshdlrssize);
 
    /* free conflict handlers */
    for( i = 0; i < (*set)->nconflicthdlrs; ++i )
@@ -2820,7 +2864,8 @@ SCIP_RETCODE SCIPsetFree(
    {
       SCIP_CALL( SCIPnodeselFree(&(*set)->nodesels[i], *set) );
    }
-   BMSfreeMemoryArrayNull(&(*set)->nodesels);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*set)->nodesels, (*set)->nodeselssize);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*set)->nodesels_name, (*set)->nodeselssize);
 
    /* free branching methods */
    for( i = 0; i < (*set)->nbranchrules; ++i )
@@ -2841,7 +2886,8 @@ SCIP_RETCODE SCIPsetFree(
    {
       SCIP_CALL( SCIPdispFree(&(*set)->disps[i], *set) );
    }
-   BMSfreeMemoryArrayNull(&(*set)->disps);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*set)->disps, (*set)->dispssize);
+   BMSfreeBlockMemoryArrayNull(blkmem, &(*set)->disps_name, (*set)->dispssize);
 
    /* free dialogs */
    BMSfreeMemoryArrayNull(&(*set)->dialogs);
@@ -2894,7 +2940,7 @@ SCIP_RETCODE SCIPsetFree(
    /* free debugging data structure */
    SCIP_CALL( SCIPdebugFree(*set) );
 
-   BMSfreeMemory(set);
+   BMSfreeBlockMemory(blkmem, set);
 
    return SCIP_OKAY;
 }
@@ -3596,17 +3642,29 @@ SCIP_RETCODE SCIPsetIncludeReader(
    SCIP_READER*          reader              /**< file reader */
    )
 {
+   int i;
+
    assert(set != NULL);
    assert(reader != NULL);
 
    if( set->nreaders >= set->readerssize )
    {
-      set->readerssize = SCIPsetCalcMemGrowSize(set, set->nreaders+1);
-      SCIP_ALLOC( BMSreallocMemoryArray(&set->readers, set->readerssize) );
+      int newsize;
+
+      newsize = SCIPsetCalcMemGrowSize(set, set->nreaders+1);
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(set->blkmem, &set->readers, set->readerssize, newsize) );
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(set->blkmem, &set->readers_name, set->readerssize, newsize) );
+      set->readerssize = newsize;
    }
    assert(set->nreaders < set->readerssize);
 
    set->readers[set->nreaders] = reader;
+
+   /* sort reader into readers_name array sorted by name */
+   for( i = set->nreaders; i > 0 && strcmp(SCIPreaderGetName(set->readers_name[i-1]), SCIPreaderGetName(reader)) > 0; --i )
+      set->readers_name[i] = set->readers_name[i-1];
+   set->readers_name[i] = reader;
+
    set->nreaders++;
 
    return SCIP_OKAY;
@@ -3618,15 +3676,28 @@ SCIP_READER* SCIPsetFindReader(
    const char*           name                /**< name of file reader */
    )
 {
-   int i;
+   int left;
+   int right;
 
    assert(set != NULL);
    assert(name != NULL);
 
-   for( i = 0; i < set->nreaders; ++i )
+   /* binary search in the name-sorted copy of the readers array */
+   left = 0;
+   right = set->nreaders-1;
+   while( left <= right )
    {
-      if( strcmp(SCIPreaderGetName(set->readers[i]), name) == 0 )
-         return set->readers[i];
+      int mid;
+      int cmp;
+
+      mid = (left+right)/2;
+      cmp = strcmp(SCIPreaderGetName(set->readers_name[mid]), name);
+      if( cmp == 0 )
+         return set->readers_name[mid];
+      else if( cmp < 0 )
+         left = mid+1;
+      else
+         right = mid-1;
    }
 
    return NULL;
@@ -3794,11 +3865,15 @@ SCIP_RETCODE SCIPsetIncludeConshdlr(
    /* allocate memory */
    if( set->nconshdlrs >= set->conshdlrssize )
    {
-      set->conshdlrssize = SCIPsetCalcMemGrowSize(set, set->nconshdlrs+1);
-      SCIP_ALLOC( BMSreallocMemoryArray(&set->conshdlrs, set->conshdlrssize) );
-      SCIP_ALLOC( BMSreallocMemoryArray(&set->conshdlrs_sepa, set->conshdlrssize) );
-      SCIP_ALLOC( BMSreallocMemoryArray(&set->conshdlrs_enfo, set->conshdlrssize) );
-      SCIP_ALLOC( BMSreallocMemoryArray(&set->conshdlrs_include, set->conshdlrssize) );
+      int newsize;
+
+      newsize = SCIPsetCalcMemGrowSize(set, set->nconshdlrs+1);
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(set->blkmem, &set->conshdlrs, set->conshdlrssize, newsize) );
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(set->blkmem, &set->conshdlrs_sepa, set->conshdlrssize, newsize) );
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(set->blkmem, &set->conshdlrs_enfo, set->conshdlrssize, newsize) );
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(set->blkmem, &set->conshdlrs_include, set->conshdlrssize, newsize) );
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(set->blkmem, &set->conshdlrs_name, set->conshdlrssize, newsize) );
+      set->conshdlrssize = newsize;
    }
    assert(set->nconshdlrs < set->conshdlrssize);
 
@@ -3829,8 +3904,24 @@ SCIP_RETCODE SCIPsetIncludeConshdlr(
    /* add constraint handler into conshdlrs_include array sorted by inclusion order */
    set->conshdlrs_include[set->nconshdlrs] = conshdlr;
 
+   /* sort constraint handler into conshdlrs_name array sorted by name */
+   for( i = set->nconshdlrs; i > 0 && strcmp(SCIPconshdlrGetName(set->conshdlrs_name[i-1]), SCIPconshdlrGetName(conshdlr)) > 0; --i )
+      set->conshdlrs_name[i] = set->conshdlrs_name[i-1];
+   set->conshdlrs_name[i] = conshdlr;
+
+   /* drop cached lookup results; inclusion is rare enough that a full reset is cheapest */
+   BMSclearMemoryArray(set->conshdlrcachekey, 64);
+
    set->nconshdlrs++;
 
+   /* rebuild the needs-constraints bitmask, since the sorted insertion shifted the handler positions */
+   set->conshdlrneedsconsmask = 0;
+   for( i = MIN(set->nconshdlrs, 64) - 1; i >= 0; --i )
+   {
+      if( SCIPconshdlrNeedsCons(set->conshdlrs[i]) )
+         set->conshdlrneedsconsmask |= (uint64_t)1 << i; /*lint !e571*/
+   }
+
    return SCIP_OKAY;
 }
 
@@ -3923,18 +4014,53 @@ SCIP_CONSHDLR* SCIPsetFindConshdlr(
    const char*           name                /**< name of constraint handler */
    )
 {
-   int i;
+   SCIP_CONSHDLR* conshdlr;
+   unsigned int slot;
+   int left;
+   int right;
 
    assert(set != NULL);
    assert(name != NULL);
 
-   for( i = 0; i < set->nconshdlrs; ++i )
+   /* callers almost always pass the same few string literals ("linear", "setppc", ...), so a direct-mapped cache
+    * keyed on the name pointer serves repeated lookups with a single verifying strcmp; the verification guards
+    * against a reused buffer reappearing at the cached address with different contents and compares against the
+    * handler's own name string, which stays valid as long as the handler is included
+    */
+   slot = (unsigned int)(((uintptr_t)name * 2654435761u) >> 26) & 63u;
+   if( set->conshdlrcachekey[slot] == name && strcmp(SCIPconshdlrGetName(set->conshdlrcache[slot]), name) == 0 )
+      return set->conshdlrcache[slot];
+
+   /* binary search in the name-sorted copy of the conshdlrs array */
+   conshdlr = NULL;
+   left = 0;
+   right = set->nconshdlrs-1;
+   while( left <= right )
+   {
+      int mid;
+      int cmp;
+
+      mid = (left+right)/2;
+      cmp = strcmp(SCIPconshdlrGetName(set->conshdlrs_name[mid]), name);
+      if( cmp == 0 )
+      {
+         conshdlr = set->conshdlrs_name[mid];
+         break;
+      }
+      else if( cmp < 0 )
+         left = mid+1;
+      else
+         right = mid-1;
+   }
+
+   /* only positive results are cached, since a failed lookup leaves nothing stable to verify a later hit against */
+   if( conshdlr != NULL )
    {
-      if( strcmp(SCIPconshdlrGetName(set->conshdlrs[i]), name) == 0 )
-         return set->conshdlrs[i];
+      set->conshdlrcachekey[slot] = name;
+      set->conshdlrcache[slot] = conshdlr;
    }
 
-   return NULL;
+   return conshdlr;
 }
 
 /** inserts conflict handler in conflict handler list */
@@ -4719,8 +4845,12 @@ SCIP_RETCODE SCIPsetIncludeNodesel(
 
    if( set->nnodesels >= set->nodeselssize )
    {
-      set->nodeselssize = SCIPsetCalcMemGrowSize(set, set->nnodesels+1);
-      SCIP_ALLOC( BMSreallocMemoryArray(&set->nodesels, set->nodeselssize) );
+      int newsize;
+
+      newsize = SCIPsetCalcMemGrowSize(set, set->nnodesels+1);
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(set->blkmem, &set->nodesels, set->nodeselssize, newsize) );
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(set->blkmem, &set->nodesels_name, set->nodeselssize, newsize) );
+      set->nodeselssize = newsize;
    }
    assert(set->nnodesels < set->nodeselssize);
 
@@ -4730,6 +4860,12 @@ SCIP_RETCODE SCIPsetIncludeNodesel(
       set->nodesels[i] = set->nodesels[i-1];
 
    set->nodesels[i] = nodesel;
+
+   /* sort node selector into nodesels_name array sorted by name */
+   for( i = set->nnodesels; i > 0 && strcmp(SCIPnodeselGetName(set->nodesels_name[i-1]), SCIPnodeselGetName(nodesel)) > 0; --i )
+      set->nodesels_name[i] = set->nodesels_name[i-1];
+   set->nodesels_name[i] = nodesel;
+
    set->nnodesels++;
 
    return SCIP_OKAY;
@@ -4741,15 +4877,28 @@ SCIP_NODESEL* SCIPsetFindNodesel(
    const char*           name                /**< name of event handler */
    )
 {
-   int i;
+   int left;
+   int right;
 
    assert(set != NULL);
    assert(name != NULL);
 
-   for( i = 0; i < set->nnodesels; ++i )
+   /* binary search in the name-sorted copy of the nodesels array */
+   left = 0;
+   right = set->nnodesels-1;
+   while( left <= right )
    {
-      if( strcmp(SCIPnodeselGetName(set->nodesels[i]), name) == 0 )
-         return set->nodesels[i];
+      int mid;
+      int cmp;
+
+      mid = (left+right)/2;
+      cmp = strcmp(SCIPnodeselGetName(set->nodesels_name[mid]), name);
+      if( cmp == 0 )
+         return set->nodesels_name[mid];
+      else if( cmp < 0 )
+         left = mid+1;
+      else
+         right = mid-1;
    }
 
    return NULL;
@@ -4882,8 +5031,12 @@ SCIP_RETCODE SCIPsetIncludeDisp(
 
    if( set->ndisps >= set->dispssize )
    {
-      set->dispssize = SCIPsetCalcMemGrowSize(set, set->ndisps+1);
-      SCIP_ALLOC( BMSreallocMemoryArray(&set->disps, set->dispssize) );
+      int newsize;
+
+      newsize = SCIPsetCalcMemGrowSize(set, set->ndisps+1);
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(set->blkmem, &set->disps, set->dispssize, newsize) );
+      SCIP_ALLOC( BMSreallocBlockMemoryArray(set->blkmem, &set->disps_name, set->dispssize, newsize) );
+      set->dispssize = newsize;
    }
    assert(set->ndisps < set->dispssize);
 
@@ -4894,6 +5047,12 @@ SCIP_RETCODE SCIPsetIncludeDisp(
       set->disps[i] = set->disps[i-1];
    }
    set->disps[i] = disp;
+
+   /* sort display column into disps_name array sorted by name */
+   for( i = set->ndisps; i > 0 && strcmp(SCIPdispGetName(set->disps_name[i-1]), SCIPdispGetName(disp)) > 0; --i )
+      set->disps_name[i] = set->disps_name[i-1];
+   set->disps_name[i] = disp;
+
    set->ndisps++;
 
    return SCIP_OKAY;
@@ -4905,15 +5064,28 @@ SCIP_DISP* SCIPsetFindDisp(
    const char*           name                /**< name of display */
    )
 {
-   int i;
+   int left;
+   int right;
 
    assert(set != NULL);
    assert(name != NULL);
 
-   for( i = 0; i < set->ndisps; ++i )
+   /* binary search in the name-sorted copy of the disps array */
+   left = 0;
+   right = set->ndisps-1;
+   while( left <= right )
    {
-      if( strcmp(SCIPdispGetName(set->disps[i]), name) == 0 )
-         return set->disps[i];
+      int mid;
+      int cmp;
+
+      mid = (left+right)/2;
+      cmp = strcmp(SCIPdispGetName(set->disps_name[mid]), name);
+      if( cmp == 0 )
+         return set->disps_name[mid];
+      else if( cmp < 0 )
+         left = mid+1;
+      else
+         right = mid-1;
    }
 
    return NULL;
@@ -5702,6 +5874,44 @@ int SCIPsetCalcMemGrowSize(
    int                   num                 /**< minimum number of entries to store */
    )
 {
+   int i;
+
+   assert(set != NULL);
+
+   if( set->mem_arraygrowfac == 1.0 )  /*lint !e777*/
+      return MAX(set->mem_arraygrowinit, num);
+
+   /* rebuild the cached size table whenever the growing parameters changed since it was computed */
+   if( set->mem_arraygrowtablefac != set->mem_arraygrowfac || set->mem_arraygrowtableinit != set->mem_arraygrowinit )  /*lint !e777*/
+   {
+      int initsize;
+      int oldsize;
+      int size;
+
+      initsize = MAX(set->mem_arraygrowinit, 4);
+      size = initsize;
+      oldsize = size - 1;
+
+      set->mem_narraygrowtable = 0;
+      while( set->mem_narraygrowtable < SCIP_ARRAYGROWTABLESIZE && size > oldsize )
+      {
+         set->mem_arraygrowtable[set->mem_narraygrowtable] = size;
+         set->mem_narraygrowtable++;
+         oldsize = size;
+         size = (int)(set->mem_arraygrowfac * size + initsize);
+      }
+      set->mem_arraygrowtablefac = set->mem_arraygrowfac;
+      set->mem_arraygrowtableinit = set->mem_arraygrowinit;
+   }
+
+   /* the table holds the recurrence values in ascending order; typical requests hit one of the first few entries */
+   for( i = 0; i < set->mem_narraygrowtable; ++i )
+   {
+      if( set->mem_arraygrowtable[i] >= num )
+         return set->mem_arraygrowtable[i];
+   }
+
+   /* num exceeds the cached range (factor close to 1.0 or near integer overflow); fall back to the recurrence */
    return calcGrowSize(set->mem_arraygrowinit, set->mem_arraygrowfac, num);
 }
 
@@ -6128,6 +6338,37 @@ SCIP_Bool SCIPsetIsInfinity(
    return (val >= set->num_infinity);
 }
 
+/** builds a packed bitmask marking the entries of an array that are infinite
+ *
+ *  Bit i of mask[i/64] is set iff vals[i] >= infinity (or vals[i] <= -infinity when negated is TRUE, for lower
+ *  bounds).  The mask array must provide (nvals+63)/64 words.  Bound scans can consume the result branch-free with
+ *  the usual bitmap iteration, clearing the lowest set bit per step, instead of testing SCIPsetIsInfinity() per
+ *  element.
+ */
+void SCIPsetInfinityMask(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   const SCIP_Real*      vals,               /**< array of bound values to scan */
+   int                   nvals,              /**< length of the array */
+   SCIP_Bool             negated,            /**< test against -infinity instead of +infinity? */
+   uint64_t*             mask                /**< array of (nvals+63)/64 words to store the bitmask */
+   )
+{
+   SCIP_Real inf;
+   SCIP_Real sign;
+   int i;
+
+   assert(set != NULL);
+   assert(vals != NULL || nvals == 0);
+   assert(mask != NULL || nvals == 0);
+
+   inf = set->num_infinity;
+   sign = negated ? -1.0 : 1.0;
+
+   BMSclearMemoryArray(mask, (nvals+63)/64);
+   for( i = 0; i < nvals; ++i )
+      mask[i >> 6] |= (uint64_t)(sign * vals[i] >= inf) << (i & 63);
+}
+
 /** checks, if value is huge and should be handled separately (e.g., in activity computation) */
 SCIP_Bool SCIPsetIsHugeValue(
    SCIP_SET*             set,                /**< global SCIP settings */
@@ -6240,6 +6481,56 @@ SCIP_Bool SCIPsetIsZero(
    return EPSZ(val, set->num_epsilon);
 }
 
+/** counts the values of an array that are not in range epsilon of 0.0
+ *
+ *  The loop is written branch-free with a hoisted tolerance so that the compiler can vectorize it; prefer this over
+ *  calling SCIPsetIsZero() per element when scanning dense coefficient or solution value arrays.
+ */
+int SCIPsetCountNonzeros(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   const SCIP_Real*      vals,               /**< array of values to scan */
+   int                   nvals               /**< length of the array */
+   )
+{
+   SCIP_Real eps;
+   int count;
+   int i;
+
+   assert(set != NULL);
+   assert(vals != NULL || nvals == 0);
+
+   eps = set->num_epsilon;
+   count = 0;
+   for( i = 0; i < nvals; ++i )
+      count += (REALABS(vals[i]) > eps ? 1 : 0);
+
+   return count;
+}
+
+/** checks whether any value of an array exceeds the feasibility tolerance in absolute value
+ *
+ *  Like SCIPsetCountNonzeros(), intended for tight residual or activity-violation scans; the whole array is combined
+ *  into one maximum before the single comparison against the tolerance.
+ */
+SCIP_Bool SCIPsetAnyViolated(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   const SCIP_Real*      vals,               /**< array of residual values to scan */
+   int                   nvals               /**< length of the array */
+   )
+{
+   SCIP_Real maxabsval;
+   int i;
+
+   assert(set != NULL);
+   assert(vals != NULL || nvals == 0);
+
+   maxabsval = 0.0;
+   for( i = 0; i < nvals; ++i )
+      maxabsval = MAX(maxabsval, REALABS(vals[i]));
+
+   return EPSP(maxabsval, set->num_feastol);
+}
+
 /** checks, if value is greater than epsilon */
 SCIP_Bool SCIPsetIsPositive(
    SCIP_SET*             set,                /**< global SCIP settings */
@@ -6326,6 +6617,50 @@ SCIP_Real SCIPsetCeil(
    return EPSCEIL(val, set->num_epsilon);
 }
 
+/** rounds all values of an array down to the next integer in epsilon tolerance
+ *
+ *  Equivalent to applying SCIPsetFloor() per element, but with the tolerance hoisted so that the rounding loop can be
+ *  vectorized; in and out may be identical for in-place rounding.
+ */
+void SCIPsetFloorArray(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   const SCIP_Real*      in,                 /**< array of values to round down */
+   SCIP_Real*            out,                /**< array to store the rounded values (may coincide with in) */
+   int                   nvals               /**< length of the arrays */
+   )
+{
+   SCIP_Real eps;
+   int i;
+
+   assert(set != NULL);
+   assert(in != NULL || nvals == 0);
+   assert(out != NULL || nvals == 0);
+
+   eps = set->num_epsilon;
+   for( i = 0; i < nvals; ++i )
+      out[i] = EPSFLOOR(in[i], eps);
+}
+
+/** rounds all values of an array up to the next integer in epsilon tolerance; see SCIPsetFloorArray() */
+void SCIPsetCeilArray(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   const SCIP_Real*      in,                 /**< array of values to round up */
+   SCIP_Real*            out,                /**< array to store the rounded values (may coincide with in) */
+   int                   nvals               /**< length of the arrays */
+   )
+{
+   SCIP_Real eps;
+   int i;
+
+   assert(set != NULL);
+   assert(in != NULL || nvals == 0);
+   assert(out != NULL || nvals == 0);
+
+   eps = set->num_epsilon;
+   for( i = 0; i < nvals; ++i )
+      out[i] = EPSCEIL(in[i], eps);
+}
+
 /** rounds value to the nearest integer in epsilon tolerance */
 SCIP_Real SCIPsetRound(
    SCIP_SET*             set,                /**< global SCIP settings */
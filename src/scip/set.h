@@ -1180,6 +1180,17 @@ SCIP_Bool SCIPsetIsInfinity(
    SCIP_Real             val                 /**< value to be compared against infinity */
    );
 
+/** builds a packed bitmask with bit i set iff vals[i] >= infinity (or vals[i] <= -infinity when negated is TRUE);
+ *  the mask array must provide (nvals+63)/64 words
+ */
+void SCIPsetInfinityMask(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   const SCIP_Real*      vals,               /**< array of bound values to scan */
+   int                   nvals,              /**< length of the array */
+   SCIP_Bool             negated,            /**< test against -infinity instead of +infinity? */
+   uint64_t*             mask                /**< array of (nvals+63)/64 words to store the bitmask */
+   );
+
 /** checks, if value is huge and should be handled separately (e.g., in activity computation) */
 SCIP_Bool SCIPsetIsHugeValue(
    SCIP_SET*             set,                /**< global SCIP settings */
@@ -1192,6 +1203,22 @@ SCIP_Bool SCIPsetIsZero(
    SCIP_Real             val                 /**< value to be compared against zero */
    );
 
+/** counts the values of an array that are not in range epsilon of 0.0; vectorizable replacement for calling
+ *  SCIPsetIsZero() per element on dense coefficient or solution value arrays
+ */
+int SCIPsetCountNonzeros(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   const SCIP_Real*      vals,               /**< array of values to scan */
+   int                   nvals               /**< length of the array */
+   );
+
+/** checks whether any value of an array exceeds the feasibility tolerance in absolute value */
+SCIP_Bool SCIPsetAnyViolated(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   const SCIP_Real*      vals,               /**< array of residual values to scan */
+   int                   nvals               /**< length of the array */
+   );
+
 /** checks, if value is greater than epsilon */
 SCIP_Bool SCIPsetIsPositive(
    SCIP_SET*             set,                /**< global SCIP settings */
@@ -1235,6 +1262,24 @@ SCIP_Real SCIPsetCeil(
    SCIP_Real             val                 /**< value to be compared against zero */
    );
 
+/** rounds all values of an array down to the next integer in epsilon tolerance; vectorizable replacement for calling
+ *  SCIPsetFloor() per element (in and out may coincide)
+ */
+void SCIPsetFloorArray(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   const SCIP_Real*      in,                 /**< array of values to round down */
+   SCIP_Real*            out,                /**< array to store the rounded values (may coincide with in) */
+   int                   nvals               /**< length of the arrays */
+   );
+
+/** rounds all values of an array up to the next integer in epsilon tolerance; see SCIPsetFloorArray() */
+void SCIPsetCeilArray(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   const SCIP_Real*      in,                 /**< array of values to round up */
+   SCIP_Real*            out,                /**< array to store the rounded values (may coincide with in) */
+   int                   nvals               /**< length of the arrays */
+   );
+
 /** rounds value to the nearest integer in epsilon tolerance */
 SCIP_Real SCIPsetRound(
    SCIP_SET*             set,                /**< global SCIP settings */
@@ -1714,6 +1759,11 @@ SCIP_Bool SCIPsetGetSubscipsOff(
 
 #endif
 
+/** hints the hardware to pull the hot head of the settings struct (the numerical tolerances) into cache; useful at
+ *  the top of loops that alternate tolerance tests with scans over large LP data
+ */
+#define SCIPsetPrefetch(set)                    SCIP_PREFETCH_READ(set)
+
 #define SCIPsetAllocBuffer(set,ptr)             ( (BMSallocBufferMemory((set)->buffer, (ptr)) == NULL) ? SCIP_NOMEMORY : SCIP_OKAY )
 #define SCIPsetAllocBufferSize(set,ptr,size)    ( (BMSallocBufferMemorySize((set)->buffer, (ptr), (size)) == NULL) ? SCIP_NOMEMORY : SCIP_OKAY )
 #define SCIPsetAllocBufferArray(set,ptr,num)    ( (BMSallocBufferMemoryArray((set)->buffer, (ptr), (num)) == NULL) ? SCIP_NOMEMORY : SCIP_OKAY )
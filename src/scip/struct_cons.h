@@ -37,6 +37,7 @@ extern "C" {
 struct SCIP_Cons
 {
    SCIP_Real             age;                /**< age of constraint: number of successive times, the constraint was irrelevant */
+   uint64_t              namehash;           /**< hash key value of constraint name, as used in the problem's consnames table */
    char*                 name;               /**< name of the constraint */
    SCIP_CONSHDLR*        conshdlr;           /**< constraint handler for this constraint */
    SCIP_CONSDATA*        consdata;           /**< data for this specific constraint */
@@ -56,6 +57,7 @@ struct SCIP_Cons
    int                   activedepth;        /**< depth level of constraint activation (-2: inactive, -1: problem constraint) */
    int                   validdepth;         /**< depth level where constraint is valid (-1: equals activedepth) */
    int                   nuses;              /**< number of times, this constraint is referenced */
+   int                   namelen;            /**< length of constraint name (without terminating zero byte) */
    unsigned int          initial:1;          /**< TRUE iff LP relaxation of constraint should be in initial LP, if possible */
    unsigned int          separate:1;         /**< TRUE iff constraint should be separated during LP processing */
    unsigned int          enforce:1;          /**< TRUE iff constraint should be enforced during node processing */
@@ -80,6 +82,7 @@ struct SCIP_Cons
    unsigned int          obsolete:1;         /**< TRUE iff constraint is too seldomly used and therefore obsolete */
    unsigned int          markpropagate:1;    /**< TRUE iff constraint is marked to be propagated in the next round */
    unsigned int          deleted:1;          /**< TRUE iff constraint was globally deleted */
+   unsigned int          inconsnames:1;      /**< TRUE iff constraint was registered in the problem's consnames table */
    unsigned int          update:1;           /**< TRUE iff constraint has to be updated in update phase */
    unsigned int          updateinsert:1;     /**< TRUE iff constraint has to be inserted in the conss array */
    unsigned int          updateactivate:1;   /**< TRUE iff constraint has to be activated in update phase */
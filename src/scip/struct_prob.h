@@ -35,15 +35,54 @@
 extern "C" {
 #endif
 
-/** main problem to solve */
+/** main problem to solve
+ *
+ *  The fields are ordered by access frequency: the variable and constraint arrays with their counters and the
+ *  objective description are touched by almost every call into prob.c and are kept together at the front, while the
+ *  name space, the user callbacks, and the bookkeeping statistics trail behind.
+ */
 struct SCIP_Prob
 {
+   /* hot part: problem traversal and objective evaluation */
    SCIP_Real             objoffset;          /**< objective offset from bound shifting and fixing (fixed vars result) */
    SCIP_Real             objscale;           /**< scalar applied to objective function; external objective value is
                                               *   extobj = objsense * objscale * (intobj + objoffset) */
    SCIP_Real             objlim;             /**< objective limit as external value (original problem space) */
+   SCIP_VAR**            vars;               /**< array with active variables ordered binary, integer, implicit, continuous */
+   uint8_t*              vartypes;           /**< parallel array with the type of each entry of vars, so that type scans
+                                              *   touch one byte per variable instead of the variable struct */
+   SCIP_Real*            varobjs;            /**< parallel array with the objective coefficient of each entry of vars;
+                                              *   only maintained for the transformed problem, where all objective
+                                              *   changes of active variables are announced to the problem data */
+   SCIP_CONS**           conss;              /**< array with constraints of the problem */
+   int                   nvars;              /**< number of active variables in the problem (used slots in vars array) */
+   int                   varssize;           /**< available slots in vars array */
+   int                   nconss;             /**< number of constraints in the problem (number of used slots in conss array) */
+   int                   consssize;          /**< available slots in conss array */
+   int                   nbinvars;           /**< number of binary variables */
+   int                   nintvars;           /**< number of general integer variables */
+   int                   nimplvars;          /**< number of implicit integer variables */
+   int                   ncontvars;          /**< number of continuous variables */
+   int                   bucketstart[5];     /**< cached start position of each variable type block in the vars array,
+                                              *   with the total number of variables as sentinel in the last entry */
+   int                   ncolvars;           /**< number of variables with attached column information */
+   int                   nobjvars;           /**< number of variables with a non-zero objective coefficient */
+   int                   nfracobjvars;       /**< number of active variables whose non-zero objective coefficient is
+                                              *   fractional or belongs to a continuous variable; only maintained for
+                                              *   the transformed problem */
+   SCIP_Real             objsensereal;       /**< objective sense as floating point multiplier (+1.0 minimize,
+                                              *   -1.0 maximize), cached to avoid the conversion in hot code */
+   SCIP_OBJSENSE         objsense;           /**< objective sense of the original problem */
+   SCIP_Bool             objisintegral;      /**< is objective value always integral for feasible solutions? */
+   SCIP_Bool             transformed;        /**< TRUE iff problem is the transformed problem */
+   SCIP_Bool             nlpenabled;         /**< marks whether an NLP relaxation should be constructed */
+   SCIP_Bool             permuted;           /**< TRUE iff the problem is already permuted */
+   SCIP_Bool             conscompression;    /**< TRUE for problems for which constraint compression on a set of fixed variables is desired */
+
+   /* cold part: name space, user callbacks, and statistics */
    SCIP_Real             dualbound;          /**< dual bound as external value (original problem space) which is given or update during presolving */
    char*                 name;               /**< problem name */
+   int                   namelen;            /**< length of problem name (without terminating zero) */
    SCIP_DECL_PROBCOPY    ((*probcopy));      /**< copies user data if you want to copy it to a subscip, or NULL */
    SCIP_DECL_PROBDELORIG ((*probdelorig));   /**< frees user data of original problem */
    SCIP_DECL_PROBTRANS   ((*probtrans));     /**< creates user data of transformed problem by transforming original user data */
@@ -52,34 +91,16 @@ struct SCIP_Prob
    SCIP_DECL_PROBEXITSOL ((*probexitsol));   /**< solving process deinitialization method of transformed data */
    SCIP_PROBDATA*        probdata;           /**< user problem data set by the reader */
    SCIP_HASHTABLE*       varnames;           /**< hash table storing variable's names */
-   SCIP_VAR**            vars;               /**< array with active variables ordered binary, integer, implicit, continuous */
+   SCIP_HASHTABLE*       consnames;          /**< hash table storing constraints' names */
    SCIP_VAR**            fixedvars;          /**< array with fixed and aggregated variables */
    SCIP_VAR**            deletedvars;        /**< array to temporarily store deleted variables */
-   SCIP_HASHTABLE*       consnames;          /**< hash table storing constraints' names */
-   SCIP_CONS**           conss;              /**< array with constraints of the problem */
-   int                   varssize;           /**< available slots in vars array */
-   int                   nvars;              /**< number of active variables in the problem (used slots in vars array) */
-   int                   nbinvars;           /**< number of binary variables */
-   int                   nintvars;           /**< number of general integer variables */
-   int                   nimplvars;          /**< number of implicit integer variables */
-   int                   ncontvars;          /**< number of continuous variables */
-   int                   ncolvars;           /**< number of variables with attached column information */
    int                   fixedvarssize;      /**< available slots in fixedvars array */
    int                   nfixedvars;         /**< number of fixed and aggregated variables in the problem */
    int                   deletedvarssize;    /**< available slots in deletedvars array */
    int                   ndeletedvars;       /**< number of deleted variables in the problem */
-   int                   nobjvars;           /**< number of variables with a non-zero objective coefficient */
-   int                   consssize;          /**< available slots in conss array */
-   int                   nconss;             /**< number of constraints in the problem (number of used slots in conss array) */
    int                   maxnconss;          /**< maximum number of constraints existing at the same time */
    int                   startnvars;         /**< number of variables existing when problem solving started */
    int                   startnconss;        /**< number of constraints existing when problem solving started */
-   SCIP_OBJSENSE         objsense;           /**< objective sense of the original problem */
-   SCIP_Bool             objisintegral;      /**< is objective value always integral for feasible solutions? */
-   SCIP_Bool             transformed;        /**< TRUE iff problem is the transformed problem */
-   SCIP_Bool             nlpenabled;         /**< marks whether an NLP relaxation should be constructed */
-   SCIP_Bool             permuted;           /**< TRUE iff the problem is already permuted */
-   SCIP_Bool             conscompression;    /**< TRUE for problems for which constraint compression on a set of fixed variables is desired */
 };
 
 #ifdef __cplusplus
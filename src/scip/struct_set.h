@@ -59,20 +59,54 @@
 extern "C" {
 #endif
 
-/** global SCIP settings */
+/** number of cached array grow sizes; 128 entries cover the full int range for every growing factor >= 1.2 */
+#define SCIP_ARRAYGROWTABLESIZE 128
+
+/** global SCIP settings
+ *
+ *  The numerical tolerances are placed at the front of the struct: they are read by the epsilon-comparison macros on
+ *  nearly every numerical operation in the solving loop, and keeping them on the first cache lines avoids pulling in
+ *  the plugin registries and parameter settings that follow.
+ */
 struct SCIP_Set
 {
+   /* numerical settings */
+   SCIP_Real             num_infinity;       /**< values larger than this are considered infinity */
+   SCIP_Real             num_epsilon;        /**< absolute values smaller than this are considered zero */
+   SCIP_Real             num_sumepsilon;     /**< absolute values of sums smaller than this are considered zero */
+   SCIP_Real             num_feastol;        /**< feasibility tolerance for constraints */
+   SCIP_Real             num_checkfeastolfac;/**< factor to change the feasibility tolerance when testing the best
+                                              *   solution for feasibility (after solving process) */
+   SCIP_Real             num_lpfeastolfactor;/**< factor w.r.t. primal feasibility tolerance that determines default (and maximal) primal feasibility tolerance of LP solver (user parameter, see also num_relaxfeastol) */
+   SCIP_Real             num_dualfeastol;    /**< feasibility tolerance for reduced costs */
+   SCIP_Real             num_barrierconvtol; /**< convergence tolerance used in barrier algorithm */
+   SCIP_Real             num_boundstreps;    /**< minimal improve for strengthening bounds */
+   SCIP_Real             num_pseudocosteps;  /**< minimal variable distance value to use for pseudo cost updates */
+   SCIP_Real             num_pseudocostdelta;/**< minimal objective distance value to use for pseudo cost updates */
+   SCIP_Real             num_recompfac;      /**< minimal decrease factor that causes the recomputation of a value
+                                              *   (e.g., pseudo objective) instead of an update */
+   SCIP_Real             num_hugeval;        /**< values larger than this are considered huge and should be handled
+                                              *   separately (e.g., in activity computation) */
+   SCIP_Real             num_relaxfeastol;   /**< primal feasibility tolerance for relaxations (set by core or plugins, not a parameter) */
+
    SCIP_STAGE            stage;              /**< SCIP operation stage */
    SCIP*                 scip;               /**< very ugly: pointer to scip main data structure for callback methods */
    SCIP_PARAMSET*        paramset;           /**< set of parameters */
+   BMS_BLKMEM*           blkmem;             /**< block memory that holds this settings object and the plugin arrays */
    BMS_BUFMEM*           buffer;             /**< memory buffers for short living temporary objects */
    BMS_BUFMEM*           cleanbuffer;        /**< memory buffers for short living temporary objects init. to all zero */
    SCIP_READER**         readers;            /**< file readers */
+   SCIP_READER**         readers_name;       /**< file readers (sorted by name for binary-search lookup) */
    SCIP_PRICER**         pricers;            /**< variable pricers */
    SCIP_CONSHDLR**       conshdlrs;          /**< constraint handlers (sorted by check priority) */
    SCIP_CONSHDLR**       conshdlrs_sepa;     /**< constraint handlers (sorted by separation priority) */
    SCIP_CONSHDLR**       conshdlrs_enfo;     /**< constraint handlers (sorted by enforcement priority) */
    SCIP_CONSHDLR**       conshdlrs_include;  /**< constraint handlers (sorted by inclusion order) */
+   SCIP_CONSHDLR**       conshdlrs_name;     /**< constraint handlers (sorted by name for binary-search lookup) */
+   SCIP_CONSHDLR*        conshdlrcache[64];  /**< direct-mapped cache of recent SCIPsetFindConshdlr() results */
+   const char*           conshdlrcachekey[64]; /**< name pointers keying conshdlrcache; lookups hit on pointer equality
+                                              *   only, so repeated queries with the same string literal are served
+                                              *   without any strcmp */
    SCIP_CONFLICTHDLR**   conflicthdlrs;      /**< conflict handlers */
    SCIP_PRESOL**         presols;            /**< presolvers */
    SCIP_RELAX**          relaxs;             /**< relaxators */
@@ -84,9 +118,11 @@ struct SCIP_Set
    SCIP_COMPR**          comprs;             /**< tree compressions */
    SCIP_EVENTHDLR**      eventhdlrs;         /**< event handlers */
    SCIP_NODESEL**        nodesels;           /**< node selectors */
+   SCIP_NODESEL**        nodesels_name;      /**< node selectors (sorted by name for binary-search lookup) */
    SCIP_NODESEL*         nodesel;            /**< currently used node selector, or NULL if invalid */
    SCIP_BRANCHRULE**     branchrules;        /**< branching rules */
    SCIP_DISP**           disps;              /**< display columns */
+   SCIP_DISP**           disps_name;         /**< display columns (sorted by name for binary-search lookup) */
    SCIP_TABLE**          tables;             /**< statistics tables */
    SCIP_DIALOG**         dialogs;            /**< dialogs */
    SCIP_EXPRHDLR**       exprhdlrs;          /**< expression handlers */
@@ -110,6 +146,8 @@ struct SCIP_Set
    int                   pricerssize;        /**< size of pricers array */
    int                   nconshdlrs;         /**< number of constraint handlers */
    int                   conshdlrssize;      /**< size of conshdlrs array */
+   uint64_t              conshdlrneedsconsmask; /**< bitmask marking which of the first 64 entries of conshdlrs
+                                              *   need constraints; rebuilt whenever a handler is included */
    int                   nconflicthdlrs;     /**< number of conflict handlers */
    int                   conflicthdlrssize;  /**< size of conflicthdlrs array */
    int                   npresols;           /**< number of presolvers */
@@ -375,6 +413,12 @@ struct SCIP_Set
    int                   mem_arraygrowinit;  /**< initial size of dynamically allocated arrays */
    int                   mem_treegrowinit;   /**< initial size of tree array */
    int                   mem_pathgrowinit;   /**< initial size of path array */
+   int                   mem_arraygrowtable[SCIP_ARRAYGROWTABLESIZE]; /**< cached ascending sequence of array grow
+                                              *   sizes, so that SCIPsetCalcMemGrowSize() can look the answer up
+                                              *   instead of iterating the growing recurrence */
+   int                   mem_narraygrowtable;/**< number of valid entries in mem_arraygrowtable */
+   SCIP_Real             mem_arraygrowtablefac; /**< growing factor the cached table was computed for */
+   int                   mem_arraygrowtableinit; /**< initial size the cached table was computed for */
 
    /* miscellaneous settings */
    SCIP_Bool             misc_catchctrlc;    /**< should the CTRL-C interrupt be caught by SCIP? */
@@ -417,25 +461,6 @@ struct SCIP_Set
    char                  nodesel_childsel;   /**< child selection rule ('d'own, 'u'p, 'p'seudo costs, 'i'nference, 'l'p value,
                                               *   'r'oot LP value difference, 'h'brid inference/root LP value difference) */
 
-   /* numerical settings */
-   SCIP_Real             num_infinity;       /**< values larger than this are considered infinity */
-   SCIP_Real             num_epsilon;        /**< absolute values smaller than this are considered zero */
-   SCIP_Real             num_sumepsilon;     /**< absolute values of sums smaller than this are considered zero */
-   SCIP_Real             num_feastol;        /**< feasibility tolerance for constraints */
-   SCIP_Real             num_checkfeastolfac;/**< factor to change the feasibility tolerance when testing the best
-                                              *   solution for feasibility (after solving process) */
-   SCIP_Real             num_lpfeastolfactor;/**< factor w.r.t. primal feasibility tolerance that determines default (and maximal) primal feasibility tolerance of LP solver (user parameter, see also num_relaxfeastol) */
-   SCIP_Real             num_dualfeastol;    /**< feasibility tolerance for reduced costs */
-   SCIP_Real             num_barrierconvtol; /**< convergence tolerance used in barrier algorithm */
-   SCIP_Real             num_boundstreps;    /**< minimal improve for strengthening bounds */
-   SCIP_Real             num_pseudocosteps;  /**< minimal variable distance value to use for pseudo cost updates */
-   SCIP_Real             num_pseudocostdelta;/**< minimal objective distance value to use for pseudo cost updates */
-   SCIP_Real             num_recompfac;      /**< minimal decrease factor that causes the recomputation of a value
-                                              *   (e.g., pseudo objective) instead of an update */
-   SCIP_Real             num_hugeval;        /**< values larger than this are considered huge and should be handled
-                                              *   separately (e.g., in activity computation) */
-   SCIP_Real             num_relaxfeastol;   /**< primal feasibility tolerance for relaxations (set by core or plugins, not a parameter) */
-
    /* presolving settings */
    SCIP_Real             presol_abortfac;    /**< abort presolve, if l.t. this frac of the problem was changed in last round */
    int                   presol_maxrounds;   /**< maximal number of presolving rounds (-1: unlimited) */
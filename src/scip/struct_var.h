@@ -242,6 +242,7 @@ struct SCIP_Var
    SCIP_HISTORY*         historycrun;        /**< branching and inference history information for current run */
    SCIP_VALUEHISTORY*    valuehistory;       /**< branching and inference history information which are value based, or NULL if not used */
    SCIP_Longint          closestvblpcount;   /**< LP count for which the closestvlbidx/closestvubidx entries are valid */
+   uint64_t              namehash;           /**< hash key value of variable name, as used in the problem's varnames table */
    int                   index;              /**< consecutively numbered variable identifier */
    int                   probindex;          /**< array position in problems vars array, or -1 if not assigned to a problem */
    int                   pseudocandindex;    /**< array position in pseudo branching candidates array, or -1 */
@@ -262,6 +263,7 @@ struct SCIP_Var
    int                   conflictubcount;    /**< number of last conflict, the upper bound was member of */
    int                   closestvlbidx;      /**< index of closest VLB variable in current LP solution, or -1 */
    int                   closestvubidx;      /**< index of closest VUB variable in current LP solution, or -1 */
+   int                   namelen;            /**< length of variable name (without terminating zero byte) */
    unsigned int          initial:1;          /**< TRUE iff var's column should be present in the initial root LP */
    unsigned int          removable:1;        /**< TRUE iff var's column is removable from the LP (due to aging or cleanup) */
    unsigned int          deletable:1;        /**< TRUE iff the variable is removable from the problem */
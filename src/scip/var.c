@@ -1905,13 +1905,20 @@ SCIP_RETCODE varSetName(
       assert(stat != NULL);
 
       (void) SCIPsnprintf(s, SCIP_MAXSTRLEN, "_var%d_", stat->nvaridx);
-      SCIP_ALLOC( BMSduplicateBlockMemoryArray(blkmem, &var->name, s, strlen(s)+1) );
+      var->namelen = (int) strlen(s);
+      SCIP_ALLOC( BMSduplicateBlockMemoryArray(blkmem, &var->name, s, var->namelen+1) );
    }
    else
    {
-      SCIP_ALLOC( BMSduplicateBlockMemoryArray(blkmem, &var->name, name, strlen(name)+1) );
+      var->namelen = (int) strlen(name);
+      SCIP_ALLOC( BMSduplicateBlockMemoryArray(blkmem, &var->name, name, var->namelen+1) );
    }
 
+   /* precompute the hash key value of the name, so that hash table operations on the variable do not need to
+    * rescan the name string
+    */
+   var->namehash = SCIPhashKeyValString(NULL, var->name);
+
    return SCIP_OKAY;
 }
 
@@ -2830,7 +2837,7 @@ SCIP_RETCODE varFree(
    SCIPvaluehistoryFree(&(*var)->valuehistory, blkmem);
 
    /* free variable data structure */
-   BMSfreeBlockMemoryArray(blkmem, &(*var)->name, strlen((*var)->name)+1);
+   BMSfreeBlockMemoryArray(blkmem, &(*var)->name, (*var)->namelen+1);
    BMSfreeBlockMemory(blkmem, var);
 
    return SCIP_OKAY;
@@ -2912,7 +2919,7 @@ SCIP_RETCODE SCIPvarChgName(
    assert(name != NULL);
 
    /* remove old variable name */
-   BMSfreeBlockMemoryArray(blkmem, &var->name, strlen(var->name)+1);
+   BMSfreeBlockMemoryArray(blkmem, &var->name, var->namelen+1);
 
    /* set new variable name */
    SCIP_CALL( varSetName(var, blkmem, NULL, name) );
@@ -6079,7 +6086,9 @@ SCIP_RETCODE SCIPvarRemove(
       }
    }
 
-   /* mark the variable to be no longer a member of the problem */
+   /* mark the variable to be no longer a member of the problem; this must also happen on the final removal, since a
+    * variable that outlives the problem through an additional capture would otherwise still report itself as active
+    */
    varSetProbindex(var, -1);
 
    return SCIP_OKAY;
@@ -6309,7 +6318,7 @@ SCIP_RETCODE SCIPvarChgObj(
           * since the objective of inactive variables cannot be changed, this corresponds to probindex != -1
           */
          if( SCIPvarIsActive(var) )
-            SCIPprobUpdateNObjVars(prob, set, oldobj, var->obj);
+            SCIPprobUpdateNObjVars(prob, set, var, oldobj, var->obj);
 
          SCIP_CALL( varEventObjChanged(var, blkmem, set, primal, lp, eventqueue, oldobj, var->obj) );
          break;
@@ -6393,7 +6402,7 @@ SCIP_RETCODE SCIPvarAddObj(
           * since the objective of inactive variables cannot be changed, this corresponds to probindex != -1
           */
          if( SCIPvarIsActive(var) )
-	    SCIPprobUpdateNObjVars(transprob, set, oldobj, var->obj);
+	    SCIPprobUpdateNObjVars(transprob, set, var, oldobj, var->obj);
 
          SCIP_CALL( varEventObjChanged(var, blkmem, set, primal, lp, eventqueue, oldobj, var->obj) );
          break;
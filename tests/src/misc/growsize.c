@@ -0,0 +1,146 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   growsize.c
+ * @brief  unittest for the grow size computations in set.c
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+#include <limits.h>
+
+#include "scip/scip.h"
+
+#include "include/scip_test.h"
+
+static SCIP* scip;
+
+/** reference implementation: the generic recurrence loop used by calcGrowSize for arbitrary growing factors
+ *
+ *  The grow sizes double as block memory size classes, so any shortcut for a special growing factor must reproduce
+ *  these values exactly.
+ */
+static
+int refGrowSize(
+   int                   initsize,           /**< initial size of array */
+   SCIP_Real             growfac,            /**< growing factor of array */
+   int                   num                 /**< minimum number of entries to store */
+   )
+{
+   int oldsize;
+   int size;
+
+   assert(initsize >= 0);
+   assert(growfac >= 1.0);
+   assert(num >= 0);
+
+   initsize = MAX(initsize, 4);
+   size = initsize;
+   oldsize = size - 1;
+
+   /* second condition checks against overflow */
+   while( size < num && size > oldsize )
+   {
+      oldsize = size;
+      size = (int)(growfac * size + initsize);
+   }
+
+   /* if an overflow happened, set the correct value */
+   if( size <= oldsize )
+      size = num;
+
+   return size;
+}
+
+static
+void setup(void)
+{
+   /* create scip */
+   SCIP_CALL( SCIPcreate(&scip) );
+}
+
+static
+void teardown(void)
+{
+   /* free scip */
+   SCIP_CALL( SCIPfree(&scip) );
+}
+
+TestSuite(growsize, .init = setup, .fini = teardown);
+
+Test(growsize, setup_and_teardown, .description = "test that setup and teardown work correctly")
+{
+}
+
+Test(growsize, test_doubling_matches_recurrence, .description = "test that the doubling shortcut reproduces the generic recurrence")
+{
+   /* growing factor 2.0 takes the bit scan shortcut in calcGrowSize */
+   static const int initsizes[] = { 0, 1, 4, 7, 256, 65536 };
+   int i;
+   int num;
+
+   SCIP_CALL( SCIPsetRealParam(scip, "memory/arraygrowfac", 2.0) );
+
+   for( i = 0; i < (int)(sizeof(initsizes)/sizeof(initsizes[0])); ++i )
+   {
+      SCIP_CALL( SCIPsetIntParam(scip, "memory/arraygrowinit", initsizes[i]) );
+
+      for( num = 0; num <= 100000; num = (num < 100 ? num + 1 : num + num/7) )
+      {
+         cr_assert_eq(refGrowSize(initsizes[i], 2.0, num), SCIPcalcMemGrowSize(scip, num),
+            "mismatch for initsize %d, num %d", initsizes[i], num);
+      }
+   }
+}
+
+Test(growsize, test_doubling_overflow, .description = "test that the doubling shortcut handles the integer overflow edge")
+{
+   static const int initsizes[] = { 0, 1, 7, 65536 };
+   static const int nums[] = { INT_MAX, INT_MAX - 1, INT_MAX / 2, INT_MAX / 2 + 7, INT_MAX / 3, 1 << 30 };
+   int i;
+   int j;
+
+   SCIP_CALL( SCIPsetRealParam(scip, "memory/arraygrowfac", 2.0) );
+
+   for( i = 0; i < (int)(sizeof(initsizes)/sizeof(initsizes[0])); ++i )
+   {
+      SCIP_CALL( SCIPsetIntParam(scip, "memory/arraygrowinit", initsizes[i]) );
+
+      for( j = 0; j < (int)(sizeof(nums)/sizeof(nums[0])); ++j )
+      {
+         cr_assert_eq(refGrowSize(initsizes[i], 2.0, nums[j]), SCIPcalcMemGrowSize(scip, nums[j]),
+            "mismatch for initsize %d, num %d", initsizes[i], nums[j]);
+      }
+   }
+}
+
+Test(growsize, test_default_matches_recurrence, .description = "test that the cached size table reproduces the generic recurrence for the default factor")
+{
+   SCIP_Real growfac;
+   int initsize;
+   int num;
+
+   SCIP_CALL( SCIPgetRealParam(scip, "memory/arraygrowfac", &growfac) );
+   SCIP_CALL( SCIPgetIntParam(scip, "memory/arraygrowinit", &initsize) );
+
+   for( num = 0; num <= 100000; num = (num < 100 ? num + 1 : num + num/7) )
+   {
+      cr_assert_eq(refGrowSize(initsize, growfac, num), SCIPcalcMemGrowSize(scip, num),
+         "mismatch for num %d", num);
+   }
+
+   cr_assert_eq(refGrowSize(initsize, growfac, INT_MAX), SCIPcalcMemGrowSize(scip, INT_MAX));
+}
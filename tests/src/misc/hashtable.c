@@ -0,0 +1,126 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2021 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   hashtable.c
+ * @brief  unittest for the keyval based hashtable interface in misc.c
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+
+#include "scip/scip.h"
+#include "scip/pub_misc.h"
+
+#include "include/scip_test.h"
+
+static SCIP* scip;
+static SCIP_HASHTABLE* hashtable;
+
+/* two distinct elements carrying equal keys, plus one element with a different key */
+static int firsttwin = 5;
+static int secondtwin = 5;
+static int loner = 42;
+
+/** get key of hash element */
+static
+SCIP_DECL_HASHGETKEY(getKey)
+{
+   return elem;
+}  /*lint !e715*/
+
+/** checks if the pointed-to values are equal */
+static
+SCIP_DECL_HASHKEYEQ(keyEQ)
+{
+   return (*(int*)key1 == *(int*)key2);
+}  /*lint !e715*/
+
+/** uses the pointed-to value as hash value */
+static
+SCIP_DECL_HASHKEYVAL(keyVal)
+{
+   return (uint64_t)(*(int*)key);
+}  /*lint !e715*/
+
+static
+void setup(void)
+{
+   /* create scip */
+   SCIP_CALL( SCIPcreate(&scip) );
+
+   /* create hash table */
+   SCIP_CALL( SCIPhashtableCreate(&hashtable, SCIPblkmem(scip), 10, getKey, keyEQ, keyVal, (void*) scip) );
+}
+
+static
+void teardown(void)
+{
+   /* free hash table */
+   SCIPhashtableFree(&hashtable);
+
+   /* free scip */
+   SCIP_CALL( SCIPfree(&scip) );
+}
+
+TestSuite(hashtable, .init = setup, .fini = teardown);
+
+Test(hashtable, setup_and_teardown, .description = "test that setup and teardown work correctly")
+{
+}
+
+Test(hashtable, test_insert_keyval, .description = "test that keyval insertion stores and retrieves entries correctly")
+{
+   SCIP_CALL( SCIPhashtableInsertKeyval(hashtable, (void*)&firsttwin, (uint64_t)firsttwin) );
+   SCIP_CALL( SCIPhashtableInsertKeyval(hashtable, (void*)&loner, (uint64_t)loner) );
+
+   cr_assert_eq(2, SCIPhashtableGetNElements(hashtable));
+   cr_assert_eq(&firsttwin, SCIPhashtableRetrieve(hashtable, (void*)&firsttwin));
+   cr_assert_eq(&loner, SCIPhashtableRetrieve(hashtable, (void*)&loner));
+}
+
+Test(hashtable, test_insert_keyval_override, .description = "test that inserting a second element with an equal key overrides the entry")
+{
+   SCIP_CALL( SCIPhashtableInsertKeyval(hashtable, (void*)&firsttwin, (uint64_t)firsttwin) );
+   SCIP_CALL( SCIPhashtableInsertKeyval(hashtable, (void*)&secondtwin, (uint64_t)secondtwin) );
+
+   /* the key now maps to the second element only */
+   cr_assert_eq(1, SCIPhashtableGetNElements(hashtable));
+   cr_assert_eq(&secondtwin, SCIPhashtableRetrieve(hashtable, (void*)&firsttwin));
+}
+
+Test(hashtable, test_remove_if_exists, .description = "test that the conditional remove drops the entry iff the key maps to the given element")
+{
+   SCIP_Bool removed;
+
+   SCIP_CALL( SCIPhashtableInsertKeyval(hashtable, (void*)&firsttwin, (uint64_t)firsttwin) );
+   SCIP_CALL( SCIPhashtableInsertKeyval(hashtable, (void*)&secondtwin, (uint64_t)secondtwin) );
+
+   /* the entry belongs to the second twin, so removing the shadowed first twin must leave it untouched */
+   SCIP_CALL( SCIPhashtableRemoveIfExists(hashtable, (void*)&firsttwin, (uint64_t)firsttwin, &removed) );
+   cr_assert(! removed);
+   cr_assert_eq(1, SCIPhashtableGetNElements(hashtable));
+   cr_assert_eq(&secondtwin, SCIPhashtableRetrieve(hashtable, (void*)&secondtwin));
+
+   /* removing the element the key actually maps to succeeds */
+   SCIP_CALL( SCIPhashtableRemoveIfExists(hashtable, (void*)&secondtwin, (uint64_t)secondtwin, &removed) );
+   cr_assert(removed);
+   cr_assert_eq(0, SCIPhashtableGetNElements(hashtable));
+   cr_assert_eq(NULL, SCIPhashtableRetrieve(hashtable, (void*)&secondtwin));
+
+   /* removing from an empty table reports no removal */
+   SCIP_CALL( SCIPhashtableRemoveIfExists(hashtable, (void*)&secondtwin, (uint64_t)secondtwin, &removed) );
+   cr_assert(! removed);
+}